@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,14 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
     std::unique_ptr<NEO::SettingsReader> settingsReader(NEO::SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(L0_CACHE_LOCATION));
 
+    std::string cacheSizeKeyName = L0::registryPath;
+    cacheSizeKeyName += "l0_cache_max_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(cacheSizeKeyName), static_cast<int64_t>(0)));
+
+    std::string inMemoryCacheSizeKeyName = L0::registryPath;
+    inMemoryCacheSizeKeyName += "l0_cache_memory_size";
+    ret.inMemoryCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(inMemoryCacheSizeKeyName), static_cast<int64_t>(0)));
+
     ret.cacheFileExtension = ".l0_cache";
 
     return ret;
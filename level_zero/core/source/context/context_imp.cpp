@@ -30,6 +30,7 @@
 namespace L0 {
 
 ze_result_t ContextImp::destroy() {
+    cleanupUsmMemAllocPools();
     while (driverHandle->svmAllocsManager->getNumDeferFreeAllocs() > 0) {
         this->driverHandle->svmAllocsManager->freeSVMAllocDeferImpl();
     }
@@ -127,6 +128,14 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
         unifiedMemoryProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(*ptr);
     }
 
+    if (usmHostMemAllocPool.isInitialized()) {
+        auto pooledPtr = usmHostMemAllocPool.createUnifiedMemoryAllocation(size, alignment, unifiedMemoryProperties);
+        if (pooledPtr) {
+            *ptr = pooledPtr;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     auto usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
                                                                                           unifiedMemoryProperties);
     if (usmPtr == nullptr) {
@@ -233,6 +242,15 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
         unifiedMemoryProperties.allocationFlags.flags.resource48Bit = 1;
     }
 
+    auto usmDeviceMemAllocPool = getUsmDeviceMemAllocPool(rootDeviceIndex);
+    if (usmDeviceMemAllocPool) {
+        auto pooledPtr = usmDeviceMemAllocPool->createUnifiedMemoryAllocation(size, alignment, unifiedMemoryProperties);
+        if (pooledPtr) {
+            *ptr = pooledPtr;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     void *usmPtr =
         this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
     if (usmPtr == nullptr) {
@@ -387,6 +405,11 @@ ze_result_t ContextImp::freeMem(const void *ptr) {
 }
 
 ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
+    auto usmMemAllocPool = getUsmMemAllocPoolForPointer(ptr);
+    if (usmMemAllocPool) {
+        return usmMemAllocPool->freeSVMAlloc(ptr, blocking) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     auto allocation = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocation == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -407,6 +430,11 @@ ze_result_t ContextImp::freeMemExt(const ze_memory_free_ext_desc_t *pMemFreeDesc
         return this->freeMem(ptr, true);
     }
     if (pMemFreeDesc->freePolicy == ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_DEFER_FREE) {
+        auto usmMemAllocPool = getUsmMemAllocPoolForPointer(ptr);
+        if (usmMemAllocPool) {
+            return usmMemAllocPool->freeSVMAllocDefer(ptr) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
         auto allocation = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
         if (allocation == nullptr) {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -493,6 +521,21 @@ ze_result_t ContextImp::evictImage(ze_device_handle_t hDevice, ze_image_handle_t
 ze_result_t ContextImp::getMemAddressRange(const void *ptr,
                                            void **pBase,
                                            size_t *pSize) {
+    auto usmMemAllocPool = getUsmMemAllocPoolForPointer(ptr);
+    if (usmMemAllocPool) {
+        auto pooledBase = usmMemAllocPool->getPooledAllocationBasePtr(ptr);
+        if (pooledBase == nullptr) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        if (pBase) {
+            *pBase = pooledBase;
+        }
+        if (pSize) {
+            *pSize = usmMemAllocPool->getPooledAllocationSize(ptr);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         NEO::GraphicsAllocation *alloc;
@@ -517,6 +560,9 @@ ze_result_t ContextImp::closeIpcMemHandle(const void *ptr) {
 
 ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
                                         ze_ipc_mem_handle_t *pIpcHandle) {
+    if (getUsmMemAllocPoolForPointer(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         auto *memoryManager = driverHandle->getMemoryManager();
@@ -546,6 +592,9 @@ ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
 ze_result_t ContextImp::getIpcMemHandles(const void *ptr,
                                          uint32_t *numIpcHandles,
                                          ze_ipc_mem_handle_t *pIpcHandles) {
+    if (getUsmMemAllocPoolForPointer(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         auto alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
@@ -836,6 +885,70 @@ ze_result_t ContextImp::freeVirtualMem(const void *ptr,
     }
 }
 
+void ContextImp::initUsmMemAllocPools() {
+    auto svmAllocsManager = this->driverHandle->svmAllocsManager;
+    if (NEO::DebugManager.flags.EnableHostUsmAllocationPool.get() > 0) {
+        NEO::SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY,
+                                                                        this->rootDeviceIndices,
+                                                                        this->deviceBitfields);
+        usmHostMemAllocPool.initialize(svmAllocsManager, memoryProperties, NEO::DebugManager.flags.EnableHostUsmAllocationPool.get() * MemoryConstants::megaByte);
+    }
+
+    if (NEO::DebugManager.flags.EnableDeviceUsmAllocationPool.get() > 0) {
+        for (auto &pairDevice : this->devices) {
+            auto neoDevice = Device::fromHandle(pairDevice.second)->getNEODevice();
+            auto deviceBitfields = this->driverHandle->deviceBitfields;
+            deviceBitfields[pairDevice.first] = neoDevice->getDeviceBitfield();
+            NEO::SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, this->driverHandle->rootDeviceIndices, deviceBitfields);
+            memoryProperties.allocationFlags.flags.shareable = isShareableMemory(nullptr, false, neoDevice);
+            memoryProperties.device = neoDevice;
+
+            auto usmDeviceMemAllocPool = std::make_unique<NEO::UsmMemAllocPool>();
+            if (usmDeviceMemAllocPool->initialize(svmAllocsManager, memoryProperties, NEO::DebugManager.flags.EnableDeviceUsmAllocationPool.get() * MemoryConstants::megaByte)) {
+                usmDeviceMemAllocPools.insert({pairDevice.first, std::move(usmDeviceMemAllocPool)});
+            }
+        }
+    }
+}
+
+void ContextImp::cleanupUsmMemAllocPools() {
+    cleanupUsmMemAllocPool(usmHostMemAllocPool);
+    for (auto &usmDeviceMemAllocPool : usmDeviceMemAllocPools) {
+        cleanupUsmMemAllocPool(*usmDeviceMemAllocPool.second);
+    }
+    usmDeviceMemAllocPools.clear();
+}
+
+void ContextImp::cleanupUsmMemAllocPool(NEO::UsmMemAllocPool &usmMemAllocPool) {
+    if (!usmMemAllocPool.isInitialized()) {
+        return;
+    }
+    for (auto &pairDevice : this->devices) {
+        this->freePeerAllocations(usmMemAllocPool.getPoolAddress(), true, Device::fromHandle(pairDevice.second));
+    }
+    usmMemAllocPool.cleanup();
+}
+
+NEO::UsmMemAllocPool *ContextImp::getUsmDeviceMemAllocPool(uint32_t rootDeviceIndex) {
+    auto usmDeviceMemAllocPool = usmDeviceMemAllocPools.find(rootDeviceIndex);
+    if (usmDeviceMemAllocPool == usmDeviceMemAllocPools.end()) {
+        return nullptr;
+    }
+    return usmDeviceMemAllocPool->second.get();
+}
+
+NEO::UsmMemAllocPool *ContextImp::getUsmMemAllocPoolForPointer(const void *ptr) {
+    if (usmHostMemAllocPool.isInPool(ptr)) {
+        return &usmHostMemAllocPool;
+    }
+    for (auto &usmDeviceMemAllocPool : usmDeviceMemAllocPools) {
+        if (usmDeviceMemAllocPool.second->isInPool(ptr)) {
+            return usmDeviceMemAllocPool.second.get();
+        }
+    }
+    return nullptr;
+}
+
 size_t ContextImp::getPageSizeRequired(size_t size) {
     return std::max(Math::prevPowerOfTwo(size), MemoryConstants::pageSize64k);
 }
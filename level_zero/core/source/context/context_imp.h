@@ -8,11 +8,13 @@
 #pragma once
 
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/context/context.h"
 
 #include <map>
+#include <memory>
 
 namespace L0 {
 struct StructuresLookupTable;
@@ -172,14 +174,23 @@ struct ContextImp : Context {
     }
     NEO::VirtualMemoryReservation *findSupportedVirtualReservation(const void *ptr, size_t size);
 
+    void initUsmMemAllocPools();
+    void cleanupUsmMemAllocPools();
+    NEO::UsmMemAllocPool *getUsmHostMemAllocPool() { return &usmHostMemAllocPool; }
+    NEO::UsmMemAllocPool *getUsmDeviceMemAllocPool(uint32_t rootDeviceIndex);
+    NEO::UsmMemAllocPool *getUsmMemAllocPoolForPointer(const void *ptr);
+
   protected:
     bool isAllocationSuitableForCompression(const StructuresLookupTable &structuresLookupTable, Device &device, size_t allocSize);
     size_t getPageSizeRequired(size_t size);
+    void cleanupUsmMemAllocPool(NEO::UsmMemAllocPool &usmMemAllocPool);
 
     std::map<uint32_t, ze_device_handle_t> devices;
     std::vector<ze_device_handle_t> deviceHandles;
     DriverHandleImp *driverHandle = nullptr;
     uint32_t numDevices = 0;
+    NEO::UsmMemAllocPool usmHostMemAllocPool;
+    std::map<uint32_t, std::unique_ptr<NEO::UsmMemAllocPool>> usmDeviceMemAllocPools;
 };
 
 } // namespace L0
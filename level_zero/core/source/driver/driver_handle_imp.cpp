@@ -84,6 +84,7 @@ ze_result_t DriverHandleImp::createContext(const ze_context_desc_t *desc,
     }
 
     context->rootDeviceIndices.remove_duplicates();
+    context->initUsmMemAllocPools();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -158,7 +159,7 @@ DriverHandleImp::~DriverHandleImp() {
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
-            this->svmAllocsManager->trimUSMDeviceAllocCache();
+            this->svmAllocsManager->trimUSMAllocCaches();
         }
     }
 
@@ -180,7 +181,7 @@ DriverHandleImp::~DriverHandleImp() {
     this->fabricEdges.clear();
 
     if (this->svmAllocsManager) {
-        this->svmAllocsManager->trimUSMDeviceAllocCache();
+        this->svmAllocsManager->trimUSMAllocCaches();
         delete this->svmAllocsManager;
         this->svmAllocsManager = nullptr;
     }
@@ -40,6 +40,10 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+bool PageFaultManager::isChunkedMigrationSupported() {
+    // page fault copies always cover whole allocation
+    return false;
+}
 } // namespace NEO
 
 namespace L0 {
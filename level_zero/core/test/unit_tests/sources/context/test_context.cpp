@@ -8,6 +8,7 @@
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/blit_properties.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
@@ -410,6 +411,132 @@ TEST_F(ContextTest, whenCreatingAndDestroyingContextThenSuccessIsReturned) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
+TEST_F(ContextTest, givenUsmAllocationPoolsDisabledByDefaultWhenCreatingContextThenPoolsAreNotInitialized) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+
+    ze_result_t res = driverHandle->createContext(&desc, 0u, nullptr, &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+    EXPECT_FALSE(contextImp->getUsmHostMemAllocPool()->isInitialized());
+    EXPECT_EQ(nullptr, contextImp->getUsmDeviceMemAllocPool(device->getRootDeviceIndex()));
+
+    contextImp->destroy();
+}
+
+struct ContextUsmPoolingTest : public ContextTest {
+    void SetUp() override {
+        DebugManager.flags.EnableHostUsmAllocationPool.set(2);
+        DebugManager.flags.EnableDeviceUsmAllocationPool.set(2);
+        ContextTest::SetUp();
+
+        ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+        ze_context_handle_t hContext;
+        ASSERT_EQ(ZE_RESULT_SUCCESS, driverHandle->createContext(&desc, 0u, nullptr, &hContext));
+        contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+    }
+
+    void TearDown() override {
+        contextImp->destroy();
+        ContextTest::TearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+    ContextImp *contextImp = nullptr;
+};
+
+TEST_F(ContextUsmPoolingTest, givenUsmAllocationPoolsEnabledWhenAllocatingSmallDeviceMemoryThenItIsSubAllocatedFromPool) {
+    auto usmDeviceMemAllocPool = contextImp->getUsmDeviceMemAllocPool(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, usmDeviceMemAllocPool);
+    EXPECT_TRUE(usmDeviceMemAllocPool->isInitialized());
+    auto numAllocs = driverHandle->svmAllocsManager->getNumAllocs();
+
+    constexpr size_t allocationSize = 3 * MemoryConstants::kiloByte;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *first = nullptr;
+    void *second = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocDeviceMem(device->toHandle(), &deviceDesc, allocationSize, 0u, &first));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocDeviceMem(device->toHandle(), &deviceDesc, allocationSize, 0u, &second));
+    EXPECT_TRUE(usmDeviceMemAllocPool->isInPool(first));
+    EXPECT_TRUE(usmDeviceMemAllocPool->isInPool(second));
+    EXPECT_EQ(numAllocs, driverHandle->svmAllocsManager->getNumAllocs());
+
+    auto interiorPtr = ptrOffset(second, 16u);
+    auto allocData = driverHandle->svmAllocsManager->getSVMAlloc(interiorPtr);
+    ASSERT_NE(nullptr, allocData);
+    EXPECT_EQ(InternalMemoryType::DEVICE_UNIFIED_MEMORY, allocData->memoryType);
+
+    void *base = nullptr;
+    size_t size = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->getMemAddressRange(interiorPtr, &base, &size));
+    EXPECT_EQ(second, base);
+    EXPECT_EQ(allocationSize, size);
+
+    ze_ipc_mem_handle_t ipcHandle = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, contextImp->getIpcMemHandle(second, &ipcHandle));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, contextImp->freeMem(interiorPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(second));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, contextImp->getMemAddressRange(interiorPtr, &base, &size));
+
+    auto usedSize = usmDeviceMemAllocPool->getUsedSize();
+    EXPECT_NE(0u, usedSize);
+
+    auto &engine = device->getNEODevice()->getDefaultEngine();
+    auto contextId = engine.osContext->getContextId();
+    auto poolAllocation = allocData->gpuAllocations.getDefaultGraphicsAllocation();
+    poolAllocation->updateTaskCount(*engine.commandStreamReceiver->getTagAddress() + 1, contextId);
+
+    ze_memory_free_ext_desc_t memFreeDesc = {};
+    memFreeDesc.freePolicy = ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_DEFER_FREE;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMemExt(&memFreeDesc, first));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, contextImp->getMemAddressRange(first, &base, &size));
+    EXPECT_EQ(usedSize, usmDeviceMemAllocPool->getUsedSize());
+    EXPECT_EQ(1u, usmDeviceMemAllocPool->getNumDeferredChunks());
+
+    poolAllocation->updateTaskCount(NEO::GraphicsAllocation::objectNotUsed, contextId);
+    usmDeviceMemAllocPool->freeSVMAllocDeferImpl();
+    EXPECT_EQ(0u, usmDeviceMemAllocPool->getUsedSize());
+    EXPECT_EQ(0u, usmDeviceMemAllocPool->getNumDeferredChunks());
+    EXPECT_EQ(numAllocs, driverHandle->svmAllocsManager->getNumAllocs());
+}
+
+TEST_F(ContextUsmPoolingTest, givenUsmAllocationPoolsEnabledWhenAllocatingSmallHostMemoryThenItIsSubAllocatedFromPool) {
+    auto usmHostMemAllocPool = contextImp->getUsmHostMemAllocPool();
+    EXPECT_TRUE(usmHostMemAllocPool->isInitialized());
+
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    void *ptr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocHostMem(&hostDesc, MemoryConstants::pageSize, 0u, &ptr));
+    EXPECT_TRUE(usmHostMemAllocPool->isInPool(ptr));
+
+    ze_memory_allocation_properties_t memoryProperties = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->getMemAllocProperties(ptr, &memoryProperties, nullptr));
+    EXPECT_EQ(ZE_MEMORY_TYPE_HOST, memoryProperties.type);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(ptr, true));
+    EXPECT_EQ(0u, usmHostMemAllocPool->getUsedSize());
+}
+
+TEST_F(ContextUsmPoolingTest, givenUsmAllocationPoolsEnabledWhenAllocationDoesNotFitPoolThenRegularAllocationIsCreated) {
+    auto usmDeviceMemAllocPool = contextImp->getUsmDeviceMemAllocPool(device->getRootDeviceIndex());
+    ASSERT_NE(nullptr, usmDeviceMemAllocPool);
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    void *bigAllocation = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocDeviceMem(device->toHandle(), &deviceDesc, NEO::UsmMemAllocPool::allocationThreshold + 1, 0u, &bigAllocation));
+    EXPECT_FALSE(usmDeviceMemAllocPool->isInPool(bigAllocation));
+
+    deviceDesc.flags = ZE_DEVICE_MEM_ALLOC_FLAG_BIAS_UNCACHED;
+    void *uncachedAllocation = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocDeviceMem(device->toHandle(), &deviceDesc, 1u, 0u, &uncachedAllocation));
+    EXPECT_FALSE(usmDeviceMemAllocPool->isInPool(uncachedAllocation));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(bigAllocation));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(uncachedAllocation));
+    EXPECT_EQ(0u, usmDeviceMemAllocPool->getUsedSize());
+}
+
 using ContextMakeMemoryResidentTests = Test<HostPointerManagerFixure>;
 
 TEST_F(ContextMakeMemoryResidentTests,
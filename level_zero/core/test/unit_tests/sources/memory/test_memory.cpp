@@ -3284,6 +3284,36 @@ HWTEST2_F(MultipleDevicePeerAllocationTest,
     ASSERT_EQ(result, ZE_RESULT_SUCCESS);
 }
 
+HWTEST_F(MultipleDevicePeerAllocationTest,
+         givenPooledDeviceAllocationUsedByPeerDeviceWhenCleaningUpPoolsThenPeerAllocationOfPoolIsFreed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeviceUsmAllocationPool.set(2);
+    context->initUsmMemAllocPools();
+
+    L0::Device *device0 = driverHandle->devices[0];
+    L0::Device *device1 = driverHandle->devices[1];
+    L0::DeviceImp *deviceImp1 = static_cast<L0::DeviceImp *>(device1);
+    auto usmDeviceMemAllocPool = context->getUsmDeviceMemAllocPool(device0->getRootDeviceIndex());
+    ASSERT_NE(nullptr, usmDeviceMemAllocPool);
+
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device0->toHandle(), &deviceDesc, 1024u, 1u, &ptr));
+    EXPECT_TRUE(usmDeviceMemAllocPool->isInPool(ptr));
+
+    MultipleDevicePeerAllocationTest::createModuleFromMockBinary(device1);
+    createKernel();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setArgBuffer(0, sizeof(ptr), &ptr));
+    EXPECT_EQ(1u, deviceImp1->peerAllocations.getNumAllocs());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+    EXPECT_EQ(1u, deviceImp1->peerAllocations.getNumAllocs());
+
+    context->cleanupUsmMemAllocPools();
+    EXPECT_EQ(0u, deviceImp1->peerAllocations.getNumAllocs());
+    EXPECT_EQ(nullptr, context->getUsmDeviceMemAllocPool(device0->getRootDeviceIndex()));
+}
+
 HWTEST_F(MultipleDevicePeerAllocationTest,
          givenDeviceAllocationPassedAsArgumentToKernelInPeerDeviceThenPeerAllocationIsUsed) {
     L0::Device *device0 = driverHandle->devices[0];
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,12 +9,17 @@
 
 #include <climits>
 
+#include <algorithm>
 #include <array>
 #include <cerrno>
+#include <cmath>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -288,6 +293,234 @@ bool FsAccess::directoryExists(const std::string path) {
     return true;
 }
 
+// Telemetry File Reader
+TelemetryFileReader::~TelemetryFileReader() {
+    closeFiles();
+}
+
+void TelemetryFileReader::closeFiles() {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    for (auto &fileDescriptor : fileDescriptors) {
+        this->closeFunction(fileDescriptor.second);
+    }
+    fileDescriptors.clear();
+}
+
+size_t TelemetryFileReader::getCachedFilesCount() {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    return fileDescriptors.size();
+}
+
+ze_result_t TelemetryFileReader::readValue(const std::string &file, char (&buffer)[maxValueLength]) {
+    {
+        // pread does not move the file offset, so a cached descriptor can be read by many threads at once
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto cachedFd = fileDescriptors.find(file);
+        if (cachedFd != fileDescriptors.end()) {
+            auto bytesRead = this->preadFunction(cachedFd->second, buffer, maxValueLength - 1, 0);
+            if (bytesRead > 0) {
+                buffer[bytesRead] = '\0';
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    return readLocked(file, buffer);
+}
+
+ze_result_t TelemetryFileReader::readLocked(const std::string &file, char (&buffer)[maxValueLength]) {
+    auto cachedFd = fileDescriptors.find(file);
+    bool cached = cachedFd != fileDescriptors.end();
+    int fd = cached ? cachedFd->second : this->openFunction(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return getResult(errno);
+    }
+
+    auto bytesRead = this->preadFunction(fd, buffer, maxValueLength - 1, 0);
+    if (bytesRead < 0 && cached) {
+        // Descriptor may be stale (e.g. after device rebind), retry once with a fresh one
+        this->closeFunction(fd);
+        fileDescriptors.erase(cachedFd);
+        cached = false;
+        fd = this->openFunction(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        bytesRead = this->preadFunction(fd, buffer, maxValueLength - 1, 0);
+    }
+
+    if (bytesRead <= 0) {
+        auto result = (bytesRead < 0) ? getResult(errno) : ZE_RESULT_ERROR_UNKNOWN;
+        this->closeFunction(fd);
+        if (cached) {
+            fileDescriptors.erase(cachedFd);
+        }
+        return result;
+    }
+
+    if (!cached) {
+        if (fileDescriptors.size() < maxCachedFiles) {
+            fileDescriptors.emplace(file, fd);
+        } else {
+            this->closeFunction(fd);
+        }
+    }
+    buffer[bytesRead] = '\0';
+    return ZE_RESULT_SUCCESS;
+}
+
+bool TelemetryFileReader::parseValue(const char *buffer, uint64_t &val) {
+    while (*buffer == ' ' || *buffer == '\t' || *buffer == '\n') {
+        buffer++;
+    }
+    if (*buffer < '0' || *buffer > '9') {
+        return false;
+    }
+    uint64_t value = 0u;
+    for (; *buffer >= '0' && *buffer <= '9'; buffer++) {
+        const uint64_t digit = *buffer - '0';
+        if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+    val = value;
+    return true;
+}
+
+bool TelemetryFileReader::parseValue(const char *buffer, int64_t &val) {
+    while (*buffer == ' ' || *buffer == '\t' || *buffer == '\n') {
+        buffer++;
+    }
+    const bool negative = (*buffer == '-');
+    if (negative || *buffer == '+') {
+        buffer++;
+    }
+    uint64_t magnitude = 0u;
+    if (*buffer < '0' || *buffer > '9' || !parseValue(buffer, magnitude)) {
+        return false;
+    }
+    const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1u : 0u);
+    if (magnitude > limit) {
+        return false;
+    }
+    val = negative ? static_cast<int64_t>(0u - magnitude) : static_cast<int64_t>(magnitude);
+    return true;
+}
+
+bool TelemetryFileReader::parseValue(const char *buffer, double &val) {
+    // Accept the same decimal notation as stream extraction, strtod alone would also take nan, inf and hex values
+    auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+    while (*buffer == ' ' || *buffer == '\t' || *buffer == '\n') {
+        buffer++;
+    }
+    auto end = buffer;
+    if (*end == '-' || *end == '+') {
+        end++;
+    }
+    bool hasDigits = false;
+    for (; isDigit(*end); end++) {
+        hasDigits = true;
+    }
+    if (*end == '.') {
+        for (end++; isDigit(*end); end++) {
+            hasDigits = true;
+        }
+    }
+    if (!hasDigits) {
+        return false;
+    }
+    if (*end == 'e' || *end == 'E') {
+        end++;
+        if (*end == '-' || *end == '+') {
+            end++;
+        }
+        if (!isDigit(*end)) {
+            return false;
+        }
+        while (isDigit(*end)) {
+            end++;
+        }
+    }
+
+    char number[maxValueLength] = {};
+    memcpy(number, buffer, std::min(static_cast<size_t>(end - buffer), maxValueLength - 1));
+    auto value = std::strtod(number, nullptr);
+    if (std::isinf(value)) {
+        return false;
+    }
+    val = value;
+    return true;
+}
+
+ze_result_t TelemetryFileReader::read(const std::string &file, uint64_t &val) {
+    char buffer[maxValueLength];
+    auto result = readValue(file, buffer);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    return parseValue(buffer, val) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t TelemetryFileReader::read(const std::string &file, int64_t &val) {
+    char buffer[maxValueLength];
+    auto result = readValue(file, buffer);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    return parseValue(buffer, val) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t TelemetryFileReader::read(const std::string &file, double &val) {
+    char buffer[maxValueLength];
+    auto result = readValue(file, buffer);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    return parseValue(buffer, val) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+void TelemetryFileReader::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals, std::vector<ze_result_t> &results) {
+    char buffer[maxValueLength];
+    vals.assign(files.size(), 0u);
+    results.assign(files.size(), ZE_RESULT_SUCCESS);
+
+    auto storeValue = [&](size_t index) {
+        if (results[index] == ZE_RESULT_SUCCESS && !parseValue(buffer, vals[index])) {
+            results[index] = ZE_RESULT_ERROR_UNKNOWN;
+        }
+    };
+
+    // Read every cached file under one shared lock, then open the rest under one exclusive lock
+    std::vector<size_t> uncachedFiles;
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        for (size_t i = 0; i < files.size(); i++) {
+            auto cachedFd = fileDescriptors.find(files[i]);
+            if (cachedFd == fileDescriptors.end()) {
+                uncachedFiles.push_back(i);
+                continue;
+            }
+            auto bytesRead = this->preadFunction(cachedFd->second, buffer, maxValueLength - 1, 0);
+            if (bytesRead <= 0) {
+                uncachedFiles.push_back(i);
+                continue;
+            }
+            buffer[bytesRead] = '\0';
+            storeValue(i);
+        }
+    }
+    if (uncachedFiles.empty()) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    for (auto i : uncachedFiles) {
+        results[i] = readLocked(files[i], buffer);
+        storeValue(i);
+    }
+}
+
 // Procfs Access
 const std::string ProcfsAccess::procDir = "/proc/";
 const std::string ProcfsAccess::fdDir = "/fd/";
@@ -428,8 +661,23 @@ ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
 ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
     std::string str;
     ze_result_t result;
+    const auto path = fullPath(file);
+
+    int64_t value = 0;
+    result = telemetryReader.read(path, value);
+    if (ZE_RESULT_SUCCESS == result) {
+        if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        val = static_cast<int32_t>(value);
+        return result;
+    }
+    if (ZE_RESULT_ERROR_UNKNOWN != result) {
+        return result;
+    }
 
-    result = FsAccess::read(fullPath(file), str);
+    // Fall back to stream parsing for values the telemetry reader does not handle
+    result = FsAccess::read(path, str);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -446,8 +694,23 @@ ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
 ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
     std::string str;
     ze_result_t result;
+    const auto path = fullPath(file);
+
+    uint64_t value = 0;
+    result = telemetryReader.read(path, value);
+    if (ZE_RESULT_SUCCESS == result) {
+        if (value > std::numeric_limits<uint32_t>::max()) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        val = static_cast<uint32_t>(value);
+        return result;
+    }
+    if (ZE_RESULT_ERROR_UNKNOWN != result) {
+        return result;
+    }
 
-    result = FsAccess::read(fullPath(file), str);
+    // Fall back to stream parsing for values the telemetry reader does not handle
+    result = FsAccess::read(path, str);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -464,8 +727,18 @@ ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
     std::string str;
     ze_result_t result;
+    const auto path = fullPath(file);
 
-    result = FsAccess::read(fullPath(file), str);
+    result = telemetryReader.read(path, val);
+    if (ZE_RESULT_SUCCESS == result) {
+        return result;
+    }
+    if (ZE_RESULT_ERROR_UNKNOWN != result) {
+        return result;
+    }
+
+    // Fall back to stream parsing for values the telemetry reader does not handle
+    result = FsAccess::read(path, str);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -482,8 +755,18 @@ ze_result_t SysfsAccess::read(const std::string file, double &val) {
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
     std::string str;
     ze_result_t result;
+    const auto path = fullPath(file);
 
-    result = FsAccess::read(fullPath(file), str);
+    result = telemetryReader.read(path, val);
+    if (ZE_RESULT_SUCCESS == result) {
+        return result;
+    }
+    if (ZE_RESULT_ERROR_UNKNOWN != result) {
+        return result;
+    }
+
+    // Fall back to stream parsing for values the telemetry reader does not handle
+    result = FsAccess::read(path, str);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -537,6 +820,15 @@ ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
     return FsAccess::write(fullPath(file), stream.str());
 }
 
+void SysfsAccess::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals, std::vector<ze_result_t> &results) {
+    std::vector<std::string> paths;
+    paths.reserve(files.size());
+    for (const auto &file : files) {
+        paths.push_back(fullPath(file));
+    }
+    telemetryReader.read(paths, vals, results);
+}
+
 ze_result_t SysfsAccess::scanDirEntries(const std::string path, std::vector<std::string> &list) {
     list.clear();
     return FsAccess::listDirectory(fullPath(path).c_str(), list);
@@ -553,10 +845,12 @@ ze_result_t SysfsAccess::getRealPath(const std::string path, std::string &val) {
 }
 
 ze_result_t SysfsAccess::bindDevice(std::string device) {
+    telemetryReader.closeFiles();
     return FsAccess::write(intelGpuBindEntry, device);
 }
 
 ze_result_t SysfsAccess::unbindDevice(std::string device) {
+    telemetryReader.closeFiles();
     return FsAccess::write(intelGpuUnbindEntry, device);
 }
 
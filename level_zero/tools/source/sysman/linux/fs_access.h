@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "level_zero/ze_api.h"
@@ -15,12 +16,15 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -58,6 +62,42 @@ class FsAccess {
     decltype(&stat) statSyscall = stat;
 };
 
+// Reads numeric telemetry files (frequency, energy, temperature counters) through file
+// descriptors kept open between reads. Sysfs attributes are regenerated on every read at
+// offset 0, so a pread on a cached descriptor returns the current value without the
+// open/parse/close cycle of stream based reads.
+// Reads through cached descriptors share the lock and run concurrently, only opening,
+// reopening and closing descriptors takes it exclusively.
+class TelemetryFileReader : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxCachedFiles = 256u;
+    static constexpr size_t maxValueLength = 64u;
+
+    TelemetryFileReader() = default;
+    virtual ~TelemetryFileReader();
+
+    ze_result_t read(const std::string &file, uint64_t &val);
+    ze_result_t read(const std::string &file, int64_t &val);
+    ze_result_t read(const std::string &file, double &val);
+    void read(const std::vector<std::string> &files, std::vector<uint64_t> &vals, std::vector<ze_result_t> &results);
+    void closeFiles();
+    size_t getCachedFilesCount();
+
+    static bool parseValue(const char *buffer, uint64_t &val);
+    static bool parseValue(const char *buffer, int64_t &val);
+    static bool parseValue(const char *buffer, double &val);
+
+  protected:
+    ze_result_t readValue(const std::string &file, char (&buffer)[maxValueLength]);
+    ze_result_t readLocked(const std::string &file, char (&buffer)[maxValueLength]);
+
+    std::unordered_map<std::string, int> fileDescriptors;
+    std::shared_mutex mtx;
+    decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
+    decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+};
+
 class ProcfsAccess : private FsAccess {
   public:
     static ProcfsAccess *create();
@@ -104,6 +144,8 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const double val);
     ze_result_t write(const std::string file, std::vector<std::string> val);
 
+    MOCKABLE_VIRTUAL void read(const std::vector<std::string> &files, std::vector<uint64_t> &vals, std::vector<ze_result_t> &results);
+
     MOCKABLE_VIRTUAL ze_result_t scanDirEntries(const std::string path, std::vector<std::string> &list);
     ze_result_t readSymLink(const std::string path, std::string &buf) override;
     ze_result_t getRealPath(const std::string path, std::string &buf) override;
@@ -116,6 +158,7 @@ class SysfsAccess : protected FsAccess {
 
   protected:
     std::vector<std::string> deviceNames;
+    TelemetryFileReader telemetryReader;
 
   private:
     SysfsAccess(const std::string file);
@@ -313,6 +313,16 @@ struct MockFrequencySysfsAccess : public SysfsAccess {
         return getValU32(file, val);
     }
 
+    void read(const std::vector<std::string> &files, std::vector<uint64_t> &vals, std::vector<ze_result_t> &results) override {
+        vals.assign(files.size(), 0u);
+        results.assign(files.size(), ZE_RESULT_SUCCESS);
+        for (size_t i = 0; i < files.size(); i++) {
+            uint32_t val = 0;
+            results[i] = read(files[i], val);
+            vals[i] = val;
+        }
+    }
+
     ze_result_t write(const std::string file, double val) override {
         if (isLegacy) {
             return setValLegacy(file, val);
@@ -153,5 +153,13 @@ class PublicSysfsAccess : public L0::SysfsAccess {
     using SysfsAccess::accessSyscall;
 };
 
+class PublicTelemetryFileReader : public L0::TelemetryFileReader {
+  public:
+    using TelemetryFileReader::closeFunction;
+    using TelemetryFileReader::fileDescriptors;
+    using TelemetryFileReader::openFunction;
+    using TelemetryFileReader::preadFunction;
+};
+
 } // namespace ult
 } // namespace L0
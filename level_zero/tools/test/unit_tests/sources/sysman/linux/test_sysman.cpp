@@ -13,6 +13,9 @@
 #include "level_zero/tools/source/sysman/ras/ras_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <map>
+#include <set>
+
 namespace L0 {
 namespace ult {
 
@@ -450,5 +453,209 @@ TEST_F(SysmanUnknownDriverModelTest, GivenDriverModelTypeIsNotDrmWhenExecutingSy
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pLinuxSysmanImp->init());
 }
 
+struct FakeSysfsTree {
+    static inline std::map<std::string, std::string> files;
+    static inline std::vector<std::string> openedFiles;
+    static inline std::set<int> staleFds;
+    static inline uint32_t openCalled = 0u;
+    static inline uint32_t preadCalled = 0u;
+    static inline uint32_t closeCalled = 0u;
+
+    static void reset() {
+        files.clear();
+        openedFiles.clear();
+        staleFds.clear();
+        openCalled = preadCalled = closeCalled = 0u;
+    }
+
+    static int open(const char *pathname, int flags) {
+        openCalled++;
+        if (files.find(pathname) == files.end()) {
+            errno = ENOENT;
+            return -1;
+        }
+        openedFiles.push_back(pathname);
+        return static_cast<int>(openedFiles.size());
+    }
+
+    static ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
+        preadCalled++;
+        if (staleFds.count(fd) > 0) {
+            errno = ENODEV;
+            return -1;
+        }
+        const auto &content = files[openedFiles[fd - 1]];
+        auto bytes = std::min(count, content.size());
+        memcpy(buf, content.data(), bytes);
+        return static_cast<ssize_t>(bytes);
+    }
+
+    static int close(int fd) {
+        closeCalled++;
+        return 0;
+    }
+};
+
+struct TelemetryFileReaderTest : public ::testing::Test {
+    void SetUp() override {
+        FakeSysfsTree::reset();
+        FakeSysfsTree::files["/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz"] = "1300\n";
+        FakeSysfsTree::files["/sys/class/drm/card0/hwmon/energy1_input"] = "123456789012\n";
+        FakeSysfsTree::files["/sys/class/drm/card0/hwmon/temp1_input"] = "-5\n";
+        FakeSysfsTree::files["/sys/class/drm/card0/hwmon/name"] = "i915\n";
+        reader.openFunction = FakeSysfsTree::open;
+        reader.preadFunction = FakeSysfsTree::pread;
+        reader.closeFunction = FakeSysfsTree::close;
+    }
+
+    void TearDown() override {
+        reader.closeFiles();
+        FakeSysfsTree::reset();
+    }
+
+    PublicTelemetryFileReader reader;
+};
+
+TEST_F(TelemetryFileReaderTest, GivenTelemetryFileWhenReadingItRepeatedlyThenFileIsOpenedOnceAndCurrentValueIsReturned) {
+    const std::string file{"/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz"};
+    uint64_t val = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(file, val));
+    EXPECT_EQ(1300u, val);
+
+    FakeSysfsTree::files[file] = "1450\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(file, val));
+    EXPECT_EQ(1450u, val);
+
+    EXPECT_EQ(1u, FakeSysfsTree::openCalled);
+    EXPECT_EQ(2u, FakeSysfsTree::preadCalled);
+    EXPECT_EQ(0u, FakeSysfsTree::closeCalled);
+    EXPECT_EQ(1u, reader.getCachedFilesCount());
+
+    reader.closeFiles();
+    EXPECT_EQ(1u, FakeSysfsTree::closeCalled);
+    EXPECT_EQ(0u, reader.getCachedFilesCount());
+}
+
+TEST_F(TelemetryFileReaderTest, GivenStaleDescriptorWhenReadingThenFileIsReopenedAndValueIsReturned) {
+    const std::string file{"/sys/class/drm/card0/hwmon/energy1_input"};
+    uint64_t val = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(file, val));
+    FakeSysfsTree::staleFds.insert(reader.fileDescriptors[file]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(file, val));
+    EXPECT_EQ(123456789012u, val);
+    EXPECT_EQ(2u, FakeSysfsTree::openCalled);
+    EXPECT_EQ(1u, FakeSysfsTree::closeCalled);
+    EXPECT_EQ(1u, reader.getCachedFilesCount());
+}
+
+TEST_F(TelemetryFileReaderTest, GivenMissingOrNonNumericFileWhenReadingThenErrorIsReturned) {
+    uint64_t val = 0u;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, reader.read("/sys/class/drm/card0/hwmon/missing", val));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, reader.read("/sys/class/drm/card0/hwmon/name", val));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, reader.read("/sys/class/drm/card0/hwmon/temp1_input", val));
+    EXPECT_EQ(2u, reader.getCachedFilesCount());
+
+    FakeSysfsTree::files["/sys/class/drm/card0/hwmon/empty"] = "";
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, reader.read("/sys/class/drm/card0/hwmon/empty", val));
+    EXPECT_EQ(2u, reader.getCachedFilesCount());
+}
+
+TEST_F(TelemetryFileReaderTest, GivenSignedAndFloatingPointValuesWhenReadingThenValuesAreParsed) {
+    int64_t signedVal = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("/sys/class/drm/card0/hwmon/temp1_input", signedVal));
+    EXPECT_EQ(-5, signedVal);
+
+    FakeSysfsTree::files["/sys/class/drm/card0/gt/gt0/rps_cur_freq_mhz"] = "300.5\n";
+    double doubleVal = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("/sys/class/drm/card0/gt/gt0/rps_cur_freq_mhz", doubleVal));
+    EXPECT_DOUBLE_EQ(300.5, doubleVal);
+}
+
+TEST_F(TelemetryFileReaderTest, GivenMultipleFilesWhenReadingInBatchThenValueAndResultIsReturnedPerFile) {
+    const std::vector<std::string> files{"/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz",
+                                         "/sys/class/drm/card0/hwmon/missing",
+                                         "/sys/class/drm/card0/hwmon/name",
+                                         "/sys/class/drm/card0/hwmon/energy1_input"};
+    std::vector<uint64_t> vals;
+    std::vector<ze_result_t> results;
+    reader.read(files, vals, results);
+
+    ASSERT_EQ(4u, vals.size());
+    ASSERT_EQ(4u, results.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[0]);
+    EXPECT_EQ(1300u, vals[0]);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, results[1]);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, results[2]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[3]);
+    EXPECT_EQ(123456789012u, vals[3]);
+    EXPECT_EQ(3u, reader.getCachedFilesCount());
+    EXPECT_EQ(4u, FakeSysfsTree::openCalled);
+}
+
+TEST_F(TelemetryFileReaderTest, GivenCachedFilesWhenReadingInBatchAgainThenCurrentValuesAreReadWithoutReopening) {
+    const std::vector<std::string> files{"/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz",
+                                         "/sys/class/drm/card0/hwmon/energy1_input"};
+    std::vector<uint64_t> vals;
+    std::vector<ze_result_t> results;
+    reader.read(files, vals, results);
+    EXPECT_EQ(2u, FakeSysfsTree::openCalled);
+
+    FakeSysfsTree::files[files[0]] = "1450\n";
+    FakeSysfsTree::files[files[1]] = "123456789999\n";
+    reader.read(files, vals, results);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[0]);
+    EXPECT_EQ(1450u, vals[0]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[1]);
+    EXPECT_EQ(123456789999u, vals[1]);
+    EXPECT_EQ(2u, FakeSysfsTree::openCalled);
+}
+
+TEST_F(TelemetryFileReaderTest, GivenMaxCachedFilesReachedWhenReadingAnotherFileThenItsDescriptorIsClosedAfterRead) {
+    for (size_t i = 0; i <= TelemetryFileReader::maxCachedFiles; i++) {
+        FakeSysfsTree::files["/sys/fake/file" + std::to_string(i)] = std::to_string(i);
+    }
+    uint64_t val = 0u;
+    for (size_t i = 0; i <= TelemetryFileReader::maxCachedFiles; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("/sys/fake/file" + std::to_string(i), val));
+        EXPECT_EQ(i, val);
+    }
+    EXPECT_EQ(TelemetryFileReader::maxCachedFiles, reader.getCachedFilesCount());
+    EXPECT_EQ(1u, FakeSysfsTree::closeCalled);
+}
+
+TEST(TelemetryFileReaderParseTest, GivenNumericTextWhenParsingThenValueIsReturnedOnlyForValidNumbers) {
+    uint64_t unsignedVal = 0u;
+    EXPECT_TRUE(TelemetryFileReader::parseValue(" 42\n", unsignedVal));
+    EXPECT_EQ(42u, unsignedVal);
+    EXPECT_TRUE(TelemetryFileReader::parseValue("18446744073709551615", unsignedVal));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), unsignedVal);
+    EXPECT_FALSE(TelemetryFileReader::parseValue("18446744073709551616", unsignedVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("-1", unsignedVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("", unsignedVal));
+
+    int64_t signedVal = 0;
+    EXPECT_TRUE(TelemetryFileReader::parseValue("-9223372036854775808", signedVal));
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), signedVal);
+    EXPECT_FALSE(TelemetryFileReader::parseValue("9223372036854775808", signedVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("- 1", signedVal));
+
+    double doubleVal = 0.0;
+    EXPECT_TRUE(TelemetryFileReader::parseValue(" -1.5e3\n", doubleVal));
+    EXPECT_DOUBLE_EQ(-1500.0, doubleVal);
+    EXPECT_TRUE(TelemetryFileReader::parseValue(".5", doubleVal));
+    EXPECT_DOUBLE_EQ(0.5, doubleVal);
+    EXPECT_TRUE(TelemetryFileReader::parseValue("0x10", doubleVal));
+    EXPECT_DOUBLE_EQ(0.0, doubleVal);
+    EXPECT_FALSE(TelemetryFileReader::parseValue("nan", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("inf", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("-infinity", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("1e", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("1e999", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue(".", doubleVal));
+    EXPECT_FALSE(TelemetryFileReader::parseValue("", doubleVal));
+}
+
 } // namespace ult
 } // namespace L0
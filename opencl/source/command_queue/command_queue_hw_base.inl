@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -146,16 +146,20 @@ inline bool waitForTimestampsWithinContainer(TimestampPacketContainer *container
     status = WaitStatus::NotReady;
 
     if (container) {
-        auto lastHangCheckTime = std::chrono::high_resolution_clock::now();
+        auto waitStartTime = std::chrono::high_resolution_clock::now();
+        auto lastHangCheckTime = waitStartTime;
+        int64_t timeSinceWaitStarted = 0;
         for (const auto &timestamp : container->peekNodes()) {
             for (uint32_t i = 0; i < timestamp->getPacketsUsed(); i++) {
                 while (timestamp->getContextEndValue(i) == 1) {
                     csr.downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(csr.getRootDeviceIndex()));
-                    WaitUtils::waitFunctionWithPredicate<const TSPacketType>(static_cast<TSPacketType const *>(timestamp->getContextEndAddress(i)), 1u, std::not_equal_to<TSPacketType>());
-                    if (csr.checkGpuHangDetected(std::chrono::high_resolution_clock::now(), lastHangCheckTime)) {
+                    WaitUtils::waitFunctionWithPredicate<const TSPacketType>(static_cast<TSPacketType const *>(timestamp->getContextEndAddress(i)), 1u, std::not_equal_to<TSPacketType>(), timeSinceWaitStarted);
+                    auto currentTime = std::chrono::high_resolution_clock::now();
+                    if (csr.checkGpuHangDetected(currentTime, lastHangCheckTime)) {
                         status = WaitStatus::GpuHang;
                         return false;
                     }
+                    timeSinceWaitStarted = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
                 }
                 status = WaitStatus::Ready;
                 waited = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,14 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
 
+    std::string cacheSizeKeyName = oclRegPath;
+    cacheSizeKeyName += "cl_cache_max_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(cacheSizeKeyName), static_cast<int64_t>(0)));
+
+    std::string inMemoryCacheSizeKeyName = oclRegPath;
+    inMemoryCacheSizeKeyName += "cl_cache_memory_size";
+    ret.inMemoryCacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(inMemoryCacheSizeKeyName), static_cast<int64_t>(0)));
+
     ret.cacheFileExtension = ".cl_cache";
 
     return ret;
@@ -55,7 +55,7 @@ Context::~Context() {
         multiRootDeviceTimestampPacketAllocator.reset();
     }
     if (smallBufferPoolAllocator.isAggregatedSmallBuffersEnabled(this)) {
-        smallBufferPoolAllocator.releaseSmallBufferPool();
+        smallBufferPoolAllocator.releasePools();
     }
 
     delete[] properties;
@@ -66,7 +66,7 @@ Context::~Context() {
         }
     }
     if (svmAllocsManager) {
-        svmAllocsManager->trimUSMDeviceAllocCache();
+        svmAllocsManager->trimUSMAllocCaches();
         delete svmAllocsManager;
     }
     if (driverDiagnostics) {
@@ -503,23 +503,68 @@ bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *cont
 }
 
 void Context::BufferPoolAllocator::initAggregatedSmallBuffers(Context *context) {
+    auto lock = std::unique_lock<std::mutex>(this->mutex);
+    this->context = context;
+    this->maxPooledBufferSize = BufferPoolAllocator::smallBufferThreshold;
+    if (DebugManager.flags.ExperimentalBufferPoolSizeClasses.get() == 1) {
+        this->maxPooledBufferSize = BufferPoolAllocator::largestPooledBufferSize;
+    }
+    if (this->addPool(0u) == nullptr) {
+        this->context = nullptr;
+    }
+}
+
+size_t Context::BufferPoolAllocator::getSizeClass(size_t size) {
+    size_t sizeClass = 0u;
+    while (sizeClasses[sizeClass].maxBufferSize < size) {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+Context::BufferPoolAllocator::BufferPool *Context::BufferPoolAllocator::addPool(size_t sizeClass) {
+    auto &sizeClassPools = this->bufferPools[sizeClass];
+    auto poolsCount = sizeClassPools.count.load(std::memory_order_relaxed);
+    auto poolIndex = 0u;
+    while (poolIndex < poolsCount && sizeClassPools.pools[poolIndex].mainStorage.load(std::memory_order_relaxed) != nullptr) {
+        poolIndex++;
+    }
+    auto poolSize = sizeClasses[sizeClass].poolSize;
+    if (this->context == nullptr ||
+        poolIndex >= BufferPoolAllocator::maxPoolsPerSizeClass ||
+        this->poolsTotalSize + poolSize > BufferPoolAllocator::maxPoolsTotalSize) {
+        return nullptr;
+    }
+
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
     Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
     bufferCreateArgs.doNotProvidePerformanceHints = true;
     bufferCreateArgs.makeAllocationLockable = true;
-    this->mainStorage = Buffer::create(context,
-                                       flags,
-                                       BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                       nullptr,
-                                       bufferCreateArgs,
-                                       errcodeRet);
-    if (this->mainStorage) {
-        this->chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
-                                                     BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                                     BufferPoolAllocator::chunkAlignment));
-        context->decRefInternal();
-    }
+    bufferCreateArgs.doNotUseBufferPool = true;
+    auto mainStorage = Buffer::create(this->context,
+                                      flags,
+                                      poolSize,
+                                      nullptr,
+                                      bufferCreateArgs,
+                                      errcodeRet);
+    if (mainStorage == nullptr) {
+        return nullptr;
+    }
+    this->context->decRefInternal();
+
+    auto &pool = sizeClassPools.pools[poolIndex];
+    pool.sizeClass = sizeClass;
+    pool.chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
+                                                poolSize,
+                                                BufferPoolAllocator::chunkAlignment));
+    pool.mainStorage.store(mainStorage, std::memory_order_release);
+    if (poolIndex == poolsCount) {
+        sizeClassPools.count.store(poolIndex + 1, std::memory_order_release);
+    }
+    this->poolsTotalSize += poolSize;
+    this->statistics.poolsCreated++;
+    return &pool;
 }
 
 Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
@@ -529,45 +574,135 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
                                                              void *hostPtr,
                                                              cl_int &errcodeRet) {
     errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
-    if (this->mainStorage &&
+    if (this->context &&
         this->isSizeWithinThreshold(requestedSize) &&
         this->flagsAllowBufferFromPool(flags, flagsIntel)) {
         auto lock = std::unique_lock<std::mutex>(this->mutex);
+        auto sizeClass = getSizeClass(requestedSize);
+        auto &sizeClassPools = this->bufferPools[sizeClass];
+
         cl_buffer_region bufferRegion{};
         size_t actualSize = requestedSize;
-        bufferRegion.origin = static_cast<size_t>(this->chunkAllocator->allocate(actualSize));
-        if (bufferRegion.origin == 0) {
+        BufferPool *pool = nullptr;
+        for (auto poolIndex = 0u; poolIndex < sizeClassPools.count.load(std::memory_order_relaxed); poolIndex++) {
+            auto &candidate = sizeClassPools.pools[poolIndex];
+            if (candidate.mainStorage.load(std::memory_order_relaxed) == nullptr) {
+                continue;
+            }
+            actualSize = requestedSize;
+            bufferRegion.origin = static_cast<size_t>(candidate.chunkAllocator->allocate(actualSize));
+            if (bufferRegion.origin != 0) {
+                pool = &candidate;
+                break;
+            }
+        }
+        if (pool == nullptr) {
+            pool = this->addPool(sizeClass);
+            if (pool) {
+                actualSize = requestedSize;
+                bufferRegion.origin = static_cast<size_t>(pool->chunkAllocator->allocate(actualSize));
+            }
+        }
+        if (pool == nullptr || bufferRegion.origin == 0) {
+            this->statistics.allocationsNotFromPools++;
             return nullptr;
         }
+
         bufferRegion.origin -= BufferPoolAllocator::startingOffset;
         bufferRegion.size = requestedSize;
-        auto bufferFromPool = this->mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
-        bufferFromPool->createFunction = this->mainStorage->createFunction;
+        auto mainStorage = pool->mainStorage.load(std::memory_order_relaxed);
+        auto bufferFromPool = mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
+        bufferFromPool->createFunction = mainStorage->createFunction;
         bufferFromPool->setSizeInPoolAllocator(actualSize);
+        this->statistics.allocationsFromPools++;
         return bufferFromPool;
     }
     return nullptr;
 }
 
+const Context::BufferPoolAllocator::BufferPool *Context::BufferPoolAllocator::getPoolForBuffer(const MemObj *buffer) const {
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    for (auto &sizeClassPools : this->bufferPools) {
+        auto poolsCount = sizeClassPools.count.load(std::memory_order_acquire);
+        for (auto poolIndex = 0u; poolIndex < poolsCount; poolIndex++) {
+            if (sizeClassPools.pools[poolIndex].mainStorage.load(std::memory_order_acquire) == buffer) {
+                return &sizeClassPools.pools[poolIndex];
+            }
+        }
+    }
+    return nullptr;
+}
+
 bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
-    return buffer != nullptr && this->mainStorage == buffer;
+    return this->getPoolForBuffer(buffer) != nullptr;
 }
 
 void Context::BufferPoolAllocator::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) {
     if (this->isPoolBuffer(possiblePoolBuffer)) {
-        auto lock = std::unique_lock<std::mutex>(this->mutex);
-        DEBUG_BREAK_IF(!this->mainStorage);
-        DEBUG_BREAK_IF(size == 0);
-        auto internalBufferAddress = offset + BufferPoolAllocator::startingOffset;
-        this->chunkAllocator->free(internalBufferAddress, size);
+        Buffer *trimmedMainStorage = nullptr;
+        {
+            auto lock = std::unique_lock<std::mutex>(this->mutex);
+            auto pool = this->getPoolForBuffer(possiblePoolBuffer);
+            DEBUG_BREAK_IF(!pool);
+            DEBUG_BREAK_IF(size == 0);
+            auto internalBufferAddress = offset + BufferPoolAllocator::startingOffset;
+            pool->chunkAllocator->free(internalBufferAddress, size);
+            if (pool->chunkAllocator->getUsedSize() == 0u) {
+                trimmedMainStorage = this->trimPool(pool);
+            }
+        }
+        if (trimmedMainStorage) {
+            // pool storage does not hold a context reference, balance the one its destructor releases
+            this->context->incRefInternal();
+            delete trimmedMainStorage;
+        }
+    }
+}
+
+Buffer *Context::BufferPoolAllocator::trimPool(const BufferPool *pool) {
+    auto &sizeClassPools = this->bufferPools[pool->sizeClass];
+    auto poolsCount = sizeClassPools.count.load(std::memory_order_relaxed);
+    auto livePoolsCount = 0u;
+    for (auto poolIndex = 0u; poolIndex < poolsCount; poolIndex++) {
+        if (sizeClassPools.pools[poolIndex].mainStorage.load(std::memory_order_relaxed) != nullptr) {
+            livePoolsCount++;
+        }
+    }
+    // keep one pool per size class to avoid recreating it on alternating alloc/free
+    if (livePoolsCount <= 1u) {
+        return nullptr;
+    }
+
+    auto &trimmedPool = sizeClassPools.pools[pool - sizeClassPools.pools.data()];
+    auto mainStorage = trimmedPool.mainStorage.exchange(nullptr, std::memory_order_acq_rel);
+    trimmedPool.chunkAllocator.reset();
+    this->poolsTotalSize -= sizeClasses[pool->sizeClass].poolSize;
+    this->statistics.poolsTrimmed++;
+    return mainStorage;
+}
+
+void Context::BufferPoolAllocator::releasePools() {
+    for (auto &sizeClassPools : this->bufferPools) {
+        auto poolsCount = sizeClassPools.count.load();
+        for (auto poolIndex = 0u; poolIndex < poolsCount; poolIndex++) {
+            delete sizeClassPools.pools[poolIndex].mainStorage.load();
+        }
+        sizeClassPools.count.store(0u);
+        for (auto poolIndex = 0u; poolIndex < poolsCount; poolIndex++) {
+            sizeClassPools.pools[poolIndex].mainStorage.store(nullptr);
+            sizeClassPools.pools[poolIndex].chunkAllocator.reset();
+        }
     }
+    this->poolsTotalSize = 0u;
 }
 
-void Context::BufferPoolAllocator::releaseSmallBufferPool() {
-    DEBUG_BREAK_IF(!this->mainStorage);
-    delete this->mainStorage;
-    this->mainStorage = nullptr;
+Context::BufferPoolAllocator::Statistics Context::BufferPoolAllocator::getStatistics() {
+    auto lock = std::unique_lock<std::mutex>(this->mutex);
+    return this->statistics;
 }
+
 TagAllocatorBase *Context::getMultiRootDeviceTimestampPacketAllocator() {
     return multiRootDeviceTimestampPacketAllocator.get();
 }
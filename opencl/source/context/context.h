@@ -19,6 +19,8 @@
 #include "opencl/source/helpers/destructor_callbacks.h"
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
+#include <array>
+#include <atomic>
 #include <map>
 
 enum InternalMemoryType : uint32_t;
@@ -51,8 +53,32 @@ class Context : public BaseObject<_cl_context> {
         static constexpr auto smallBufferThreshold = 4 * KB;
         static constexpr auto chunkAlignment = 512u;
         static constexpr auto startingOffset = chunkAlignment;
+        static constexpr auto maxPoolsPerSizeClass = 16u;
+        static constexpr auto maxPoolsTotalSize = 8 * MB;
+
+        struct SizeClass {
+            size_t maxBufferSize;
+            size_t poolSize;
+        };
+        static constexpr SizeClass sizeClasses[] = {{smallBufferThreshold, aggregatedSmallBuffersPoolSize},
+                                                    {64 * KB, 1 * MB},
+                                                    {256 * KB, 2 * MB}};
+        static constexpr auto numSizeClasses = sizeof(sizeClasses) / sizeof(sizeClasses[0]);
+        static constexpr auto largestPooledBufferSize = sizeClasses[numSizeClasses - 1].maxBufferSize;
 
         static_assert(aggregatedSmallBuffersPoolSize > smallBufferThreshold, "Largest allowed buffer needs to fit in pool");
+        static_assert(maxPoolsTotalSize >= sizeClasses[0].poolSize + sizeClasses[1].poolSize + sizeClasses[2].poolSize, "Every size class needs to fit at least one pool");
+
+        struct Statistics {
+            uint64_t allocationsFromPools = 0u;
+            uint64_t allocationsNotFromPools = 0u;
+            uint64_t poolsCreated = 0u;
+            uint64_t poolsTrimmed = 0u;
+
+            uint64_t getSavedAllocationsCount() const {
+                return allocationsFromPools > poolsCreated ? allocationsFromPools - poolsCreated : 0u;
+            }
+        };
 
         Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
                                        cl_mem_flags flags,
@@ -61,7 +87,7 @@ class Context : public BaseObject<_cl_context> {
                                        void *hostPtr,
                                        cl_int &errcodeRet);
         void tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size);
-        void releaseSmallBufferPool();
+        void releasePools();
 
         bool isAggregatedSmallBuffersEnabled(Context *context) const;
 
@@ -71,12 +97,36 @@ class Context : public BaseObject<_cl_context> {
 
         bool flagsAllowBufferFromPool(const cl_mem_flags &flags, const cl_mem_flags_intel &flagsIntel) const;
 
+        Statistics getStatistics();
+
       protected:
+        struct BufferPool {
+            std::atomic<Buffer *> mainStorage{nullptr};
+            std::unique_ptr<HeapAllocator> chunkAllocator;
+            size_t sizeClass = 0u;
+        };
+
+        // Pools are modified only under the mutex and never move, so lookups by
+        // buffer can walk the published prefix without locking. A trimmed pool
+        // leaves an empty slot which is reused by the next pool of its size class.
+        struct SizeClassPools {
+            std::array<BufferPool, maxPoolsPerSizeClass> pools;
+            std::atomic<uint32_t> count{0u};
+        };
+
         inline bool isSizeWithinThreshold(size_t size) const {
-            return BufferPoolAllocator::smallBufferThreshold >= size;
+            return this->maxPooledBufferSize >= size;
         }
-        Buffer *mainStorage{nullptr};
-        std::unique_ptr<HeapAllocator> chunkAllocator;
+        static size_t getSizeClass(size_t size);
+        BufferPool *addPool(size_t sizeClass);
+        const BufferPool *getPoolForBuffer(const MemObj *buffer) const;
+        Buffer *trimPool(const BufferPool *pool);
+
+        Context *context = nullptr;
+        size_t maxPooledBufferSize = smallBufferThreshold;
+        std::array<SizeClassPools, numSizeClasses> bufferPools;
+        size_t poolsTotalSize = 0u;
+        Statistics statistics;
         std::mutex mutex;
     };
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
@@ -2338,7 +2338,11 @@ void Kernel::initializeLocalIdsCache() {
                                          workgroupDimensionsOrder[2]};
     auto simdSize = getDescriptor().kernelAttributes.simdSize;
     auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
-    localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, simdSize, grfSize, usingImagesOnly);
+    size_t localIdsCacheSize = LocalIdsCache::defaultCacheSize;
+    if (DebugManager.flags.LocalIdsCacheSize.get() > 0) {
+        localIdsCacheSize = static_cast<size_t>(DebugManager.flags.LocalIdsCacheSize.get());
+    }
+    localIdsCache = std::make_unique<LocalIdsCache>(localIdsCacheSize, wgDimOrder, simdSize, grfSize, usingImagesOnly);
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
@@ -270,7 +270,8 @@ Buffer *Buffer::create(Context *context,
     const bool copyHostPtr = memoryProperties.flags.copyHostPtr;
     if (implicitScalingEnabled == false &&
         useHostPtr == false &&
-        memoryProperties.flags.forceHostMemory == false) {
+        memoryProperties.flags.forceHostMemory == false &&
+        bufferCreateArgs.doNotUseBufferPool == false) {
         cl_int poolAllocRet = CL_SUCCESS;
         auto bufferFromPool = bufferPoolAllocator.allocateBufferFromPool(memoryProperties,
                                                                          flags,
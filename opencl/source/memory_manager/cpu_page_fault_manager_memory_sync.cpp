@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -19,13 +20,25 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
-    auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
-    UNRECOVERABLE_IF(retVal);
-    retVal = commandQueue->finish();
+    auto &pageFaultData = memoryData[ptr];
+    if (pageFaultData.cpuRanges.empty()) {
+        pageFaultData.unifiedMemoryManager->insertSvmMapOperation(ptr, pageFaultData.size, ptr, 0, false);
+        auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
+        UNRECOVERABLE_IF(retVal);
+    }
+    for (auto &cpuRange : pageFaultData.cpuRanges) {
+        auto rangePtr = ptrOffset(ptr, cpuRange.first);
+        pageFaultData.unifiedMemoryManager->insertSvmMapOperation(rangePtr, cpuRange.second, ptr, cpuRange.first, false);
+        auto retVal = commandQueue->enqueueSVMUnmap(rangePtr, 0, nullptr, nullptr, false);
+        UNRECOVERABLE_IF(retVal);
+    }
+    auto retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 
-    auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
+    auto allocData = pageFaultData.unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+bool PageFaultManager::isChunkedMigrationSupported() {
+    return true;
+}
 } // namespace NEO
@@ -1,21 +1,30 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <cstdio>
+
 TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(0u, cacheConfig.cacheSize);
 }
 
 TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoaded) {
+    VariableBackup<NEO::IoFunctions::fopenFuncPtr> fopenBackup(&NEO::IoFunctions::fopenPtr, [](const char *filename, const char *mode) -> FILE * { return fopen(filename, mode); });
+    VariableBackup<NEO::IoFunctions::fwriteFuncPtr> fwriteBackup(&NEO::IoFunctions::fwritePtr, &fwrite);
+    VariableBackup<NEO::IoFunctions::fcloseFuncPtr> fcloseBackup(&NEO::IoFunctions::fclosePtr, &fclose);
+
     NEO::CompilerCache cache(NEO::getDefaultCompilerCacheConfig());
     static const char *hash = "SOME_HASH";
     std::unique_ptr<char> data(new char[32]);
@@ -32,7 +32,7 @@ class AggregatedSmallBuffersTestTemplate : public ::testing::Test {
 
     void TearDown() override {
         if (this->context->getBufferPoolAllocator().isAggregatedSmallBuffersEnabled(context.get())) {
-            this->context->getBufferPoolAllocator().releaseSmallBufferPool();
+            this->context->getBufferPoolAllocator().releasePools();
         }
     }
 
@@ -144,64 +144,239 @@ using AggregatedSmallBuffersDisabledTest = AggregatedSmallBuffersTestTemplate<0>
 
 TEST_F(AggregatedSmallBuffersDisabledTest, givenAggregatedSmallBuffersDisabledWhenBufferCreateCalledThenDoNotUsePool) {
     ASSERT_FALSE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_EQ(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(poolAllocator->getMainStorage(), nullptr);
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
 
-    EXPECT_EQ(poolAllocator->mainStorage, nullptr);
+    EXPECT_EQ(poolAllocator->getMainStorage(), nullptr);
 }
 
 using AggregatedSmallBuffersEnabledTest = AggregatedSmallBuffersTestTemplate<1>;
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledWhenAllocatingMainStorageThenMakeDeviceBufferLockable) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     ASSERT_NE(mockMemoryManager->lastAllocationProperties, nullptr);
     EXPECT_TRUE(mockMemoryManager->lastAllocationProperties->makeDeviceBufferLockable);
 }
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeLargerThanThresholdWhenBufferCreateCalledThenDoNotUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
+    size = PoolAllocator::largestPooledBufferSize + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_FALSE(buffer->isSubBuffer());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenSizeClassesNotEnabledAndSizeLargerThanSmallBufferThresholdWhenBufferCreateCalledThenDoNotUsePool) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     size = PoolAllocator::smallBufferThreshold + 1;
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_FALSE(buffer->isSubBuffer());
+    for (auto sizeClass = 1u; sizeClass < PoolAllocator::numSizeClasses; sizeClass++) {
+        EXPECT_EQ(0u, poolAllocator->getPoolsCount(sizeClass));
+    }
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenOnlyPoolOfSizeClassWhenLastBufferFromPoolIsReleasedThenPoolIsNotTrimmed) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    auto mainStorage = poolAllocator->getMainStorage();
+    ASSERT_NE(mainStorage, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_TRUE(buffer->isSubBuffer());
+
+    buffer.reset();
+    EXPECT_EQ(mainStorage, poolAllocator->getMainStorage());
+    EXPECT_EQ(0u, poolAllocator->getChunkAllocator()->getUsedSize());
+    EXPECT_EQ(0u, poolAllocator->getStatistics().poolsTrimmed);
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize, poolAllocator->poolsTotalSize);
+}
+
+class AggregatedSmallBuffersSizeClassesTest : public AggregatedSmallBuffersTestTemplate<1, false, false> {
+  public:
+    void SetUp() override {
+        DebugManager.flags.ExperimentalBufferPoolSizeClasses.set(1);
+        this->setUpImpl();
+    }
+};
+
+TEST_F(AggregatedSmallBuffersSizeClassesTest, givenSizesFromDifferentSizeClassesWhenBufferCreateCalledThenPoolOfMatchingSizeClassIsUsed) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
+    for (auto sizeClass = 1u; sizeClass < PoolAllocator::numSizeClasses; sizeClass++) {
+        EXPECT_EQ(0u, poolAllocator->getPoolsCount(sizeClass));
+    }
+
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for (auto sizeClass = 0u; sizeClass < PoolAllocator::numSizeClasses; sizeClass++) {
+        size = PoolAllocator::sizeClasses[sizeClass].maxBufferSize;
+        EXPECT_EQ(sizeClass, MockBufferPoolAllocator::getSizeClass(size));
+
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+        ASSERT_NE(buffers.back(), nullptr);
+        EXPECT_TRUE(buffers.back()->isSubBuffer());
+        EXPECT_EQ(size, buffers.back()->getSize());
+
+        EXPECT_EQ(1u, poolAllocator->getPoolsCount(sizeClass));
+        auto mainStorage = poolAllocator->getMainStorage(sizeClass);
+        ASSERT_NE(nullptr, mainStorage);
+        EXPECT_EQ(PoolAllocator::sizeClasses[sizeClass].poolSize, mainStorage->getSize());
+        EXPECT_EQ(mainStorage, static_cast<MockBuffer *>(buffers.back().get())->associatedMemObject);
+        EXPECT_TRUE(poolAllocator->isPoolBuffer(mainStorage));
+    }
+
+    buffers.clear();
+    for (auto sizeClass = 0u; sizeClass < PoolAllocator::numSizeClasses; sizeClass++) {
+        EXPECT_EQ(0u, poolAllocator->getChunkAllocator(sizeClass)->getUsedSize());
+    }
+}
+
+TEST_F(AggregatedSmallBuffersSizeClassesTest, givenBuffersFromPoolsWhenGettingStatisticsThenSavedAllocationsAreReported) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    auto statistics = poolAllocator->getStatistics();
+    EXPECT_EQ(1u, statistics.poolsCreated);
+    EXPECT_EQ(0u, statistics.allocationsFromPools);
+    EXPECT_EQ(0u, statistics.getSavedAllocationsCount());
+
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for (auto i = 0u; i < 3u; i++) {
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    }
+    size = 64 * KB;
+    buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+
+    statistics = poolAllocator->getStatistics();
+    EXPECT_EQ(2u, statistics.poolsCreated);
+    EXPECT_EQ(4u, statistics.allocationsFromPools);
+    EXPECT_EQ(0u, statistics.allocationsNotFromPools);
+    EXPECT_EQ(2u, statistics.getSavedAllocationsCount());
+
+    setAllocationToFail(true);
+    size = PoolAllocator::largestPooledBufferSize;
+    std::unique_ptr<Buffer> bufferWithoutPool(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    setAllocationToFail(false);
+
+    statistics = poolAllocator->getStatistics();
+    EXPECT_EQ(2u, statistics.poolsCreated);
+    EXPECT_EQ(1u, statistics.allocationsNotFromPools);
+}
+
+TEST_F(AggregatedSmallBuffersSizeClassesTest, givenPoolsReachingTotalSizeLimitWhenBufferCreateCalledThenNoMorePoolsAreCreatedAndBufferIsNotFromPool) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize, poolAllocator->poolsTotalSize);
+
+    constexpr auto largestSizeClass = PoolAllocator::numSizeClasses - 1;
+    constexpr auto poolSize = PoolAllocator::sizeClasses[largestSizeClass].poolSize;
+    constexpr auto expectedPoolsCount = (PoolAllocator::maxPoolsTotalSize - PoolAllocator::aggregatedSmallBuffersPoolSize) / poolSize;
+    constexpr auto buffersPerPool = poolSize / PoolAllocator::largestPooledBufferSize;
+
+    size = PoolAllocator::largestPooledBufferSize;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for (auto i = 0u; i < expectedPoolsCount * buffersPerPool; i++) {
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+        ASSERT_NE(buffers.back(), nullptr);
+        EXPECT_TRUE(buffers.back()->isSubBuffer());
+    }
+    EXPECT_EQ(expectedPoolsCount, poolAllocator->getPoolsCount(largestSizeClass));
+
+    std::unique_ptr<Buffer> bufferOverLimit(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_NE(bufferOverLimit, nullptr);
+    EXPECT_FALSE(bufferOverLimit->isSubBuffer());
+    EXPECT_EQ(expectedPoolsCount, poolAllocator->getPoolsCount(largestSizeClass));
+    EXPECT_LE(poolAllocator->poolsTotalSize, PoolAllocator::maxPoolsTotalSize);
+    EXPECT_EQ(1u, poolAllocator->getStatistics().allocationsNotFromPools);
+
+    buffers.clear();
+    bufferOverLimit.reset();
+    poolAllocator->releasePools();
+    EXPECT_EQ(0u, poolAllocator->poolsTotalSize);
+}
+
+TEST_F(AggregatedSmallBuffersSizeClassesTest, givenSecondPoolOfSizeClassWhenItBecomesFullyFreeThenItIsTrimmedAndItsSlotIsReused) {
+    ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
+    constexpr auto largestSizeClass = PoolAllocator::numSizeClasses - 1;
+    constexpr auto poolSize = PoolAllocator::sizeClasses[largestSizeClass].poolSize;
+    constexpr auto buffersPerPool = poolSize / PoolAllocator::largestPooledBufferSize;
+    auto contextRefCountBefore = context->getRefInternalCount();
+
+    size = PoolAllocator::largestPooledBufferSize;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for (auto i = 0u; i < buffersPerPool + 1; i++) {
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        ASSERT_NE(buffers.back(), nullptr);
+        EXPECT_TRUE(buffers.back()->isSubBuffer());
+    }
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount(largestSizeClass));
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize + 2 * poolSize, poolAllocator->poolsTotalSize);
+
+    buffers.pop_back();
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount(largestSizeClass));
+    EXPECT_EQ(nullptr, poolAllocator->getMainStorage(largestSizeClass, 1u));
+    EXPECT_EQ(1u, poolAllocator->getStatistics().poolsTrimmed);
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize + poolSize, poolAllocator->poolsTotalSize);
+    EXPECT_EQ(contextRefCountBefore + static_cast<int32_t>(buffersPerPool), context->getRefInternalCount());
+
+    buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    ASSERT_NE(buffers.back(), nullptr);
+    EXPECT_TRUE(buffers.back()->isSubBuffer());
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount(largestSizeClass));
+    auto reusedSlotMainStorage = poolAllocator->getMainStorage(largestSizeClass, 1u);
+    ASSERT_NE(nullptr, reusedSlotMainStorage);
+    EXPECT_EQ(reusedSlotMainStorage, static_cast<MockBuffer *>(buffers.back().get())->associatedMemObject);
+
+    buffers.clear();
+    auto livePoolsCount = 0u;
+    for (auto poolIndex = 0u; poolIndex < poolAllocator->getPoolsCount(largestSizeClass); poolIndex++) {
+        livePoolsCount += poolAllocator->getMainStorage(largestSizeClass, poolIndex) != nullptr ? 1u : 0u;
+    }
+    EXPECT_EQ(1u, livePoolsCount);
+    EXPECT_EQ(2u, poolAllocator->getStatistics().poolsTrimmed);
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize + poolSize, poolAllocator->poolsTotalSize);
+    EXPECT_EQ(contextRefCountBefore, context->getRefInternalCount());
 }
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeLowerThenChunkAlignmentWhenBufferCreatedAndDestroyedThenSizeIsAsRequestedAndCorrectSizeIsFreed) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
-    ASSERT_EQ(poolAllocator->chunkAllocator->getUsedSize(), 0u);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
+    ASSERT_EQ(poolAllocator->getChunkAllocator()->getUsedSize(), 0u);
     size = PoolAllocator::chunkAlignment / 2;
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
     EXPECT_EQ(buffer->getSize(), size);
-    EXPECT_EQ(poolAllocator->chunkAllocator->getUsedSize(), PoolAllocator::chunkAlignment);
+    EXPECT_EQ(poolAllocator->getChunkAllocator()->getUsedSize(), PoolAllocator::chunkAlignment);
     auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
     EXPECT_EQ(mockBuffer->sizeInPoolAllocator, PoolAllocator::chunkAlignment);
 
     buffer.reset(nullptr);
-    EXPECT_EQ(poolAllocator->chunkAllocator->getUsedSize(), 0u);
+    EXPECT_EQ(poolAllocator->getChunkAllocator()->getUsedSize(), 0u);
 }
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledThenUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
 
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
 
-    EXPECT_NE(poolAllocator->mainStorage, nullptr);
+    EXPECT_NE(poolAllocator->getMainStorage(), nullptr);
     auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
     EXPECT_GE(mockBuffer->getSize(), size);
     EXPECT_GE(mockBuffer->getOffset(), 0u);
     EXPECT_LE(mockBuffer->getOffset(), PoolAllocator::aggregatedSmallBuffersPoolSize - size);
     EXPECT_TRUE(mockBuffer->isSubBuffer());
-    EXPECT_EQ(poolAllocator->mainStorage, mockBuffer->associatedMemObject);
+    EXPECT_EQ(poolAllocator->getMainStorage(), mockBuffer->associatedMemObject);
 
     retVal = clReleaseMemObject(buffer.release());
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -209,16 +384,16 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledWhenClReleaseMemObjectCalledThenWaitForEnginesCompletionCalled) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
 
     ASSERT_NE(buffer, nullptr);
     ASSERT_EQ(retVal, CL_SUCCESS);
 
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
     ASSERT_TRUE(mockBuffer->isSubBuffer());
-    ASSERT_EQ(poolAllocator->mainStorage, mockBuffer->associatedMemObject);
+    ASSERT_EQ(poolAllocator->getMainStorage(), mockBuffer->associatedMemObject);
 
     ASSERT_EQ(mockMemoryManager->waitForEnginesCompletionCalled, 0u);
     retVal = clReleaseMemObject(buffer.release());
@@ -250,7 +425,7 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenCopyHostPointerWhenCreatingBuffer
     hostPtr = dataToCopy;
 
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     if (commandQueue->writeBufferCounter == 0) {
         GTEST_SKIP();
@@ -266,7 +441,7 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenCopyHostPointerWhenCreatingBuffer
 
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledMultipleTimesThenUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
 
     constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
     std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
@@ -274,11 +449,15 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
         buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
         EXPECT_EQ(retVal, CL_SUCCESS);
     }
-    EXPECT_NE(poolAllocator->mainStorage, nullptr);
+    EXPECT_NE(poolAllocator->getMainStorage(), nullptr);
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
     std::unique_ptr<Buffer> bufferAfterPoolIsFull(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_EQ(retVal, CL_SUCCESS);
-    EXPECT_NE(bufferAfterPoolIsFull, nullptr);
-    EXPECT_FALSE(bufferAfterPoolIsFull->isSubBuffer());
+    ASSERT_NE(bufferAfterPoolIsFull, nullptr);
+    // full pool is extended with another one of the same size class
+    EXPECT_TRUE(bufferAfterPoolIsFull->isSubBuffer());
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(poolAllocator->getMainStorage(0u, 1u), static_cast<MockBuffer *>(bufferAfterPoolIsFull.get())->associatedMemObject);
 
     using Bounds = struct {
         size_t left;
@@ -292,7 +471,7 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
         EXPECT_NE(buffers[i], nullptr);
         EXPECT_TRUE(buffers[i]->isSubBuffer());
         auto mockBuffer = static_cast<MockBuffer *>(buffers[i].get());
-        EXPECT_EQ(poolAllocator->mainStorage, mockBuffer->associatedMemObject);
+        EXPECT_EQ(poolAllocator->getMainStorage(), mockBuffer->associatedMemObject);
         EXPECT_GE(mockBuffer->getSize(), size);
         EXPECT_GE(mockBuffer->getOffset(), 0u);
         EXPECT_LE(mockBuffer->getOffset(), PoolAllocator::aggregatedSmallBuffersPoolSize - size);
@@ -309,9 +488,9 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
     }
 
     // freeing subbuffer frees space in pool
-    ASSERT_LT(poolAllocator->chunkAllocator->getLeftSize(), size);
+    ASSERT_LT(poolAllocator->getChunkAllocator()->getLeftSize(), size);
     clReleaseMemObject(buffers[0].release());
-    EXPECT_GE(poolAllocator->chunkAllocator->getLeftSize(), size);
+    EXPECT_GE(poolAllocator->getChunkAllocator()->getLeftSize(), size);
     std::unique_ptr<Buffer> bufferAfterPoolHasSpaceAgain(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_EQ(retVal, CL_SUCCESS);
     ASSERT_NE(bufferAfterPoolHasSpaceAgain, nullptr);
@@ -354,12 +533,12 @@ using AggregatedSmallBuffersEnabledTestFailPoolInit = AggregatedSmallBuffersTest
 
 TEST_F(AggregatedSmallBuffersEnabledTestFailPoolInit, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledButPoolCreateFailedThenDoNotUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_EQ(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(poolAllocator->getMainStorage(), nullptr);
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
 
     EXPECT_EQ(retVal, CL_SUCCESS);
     EXPECT_NE(buffer.get(), nullptr);
-    EXPECT_EQ(poolAllocator->mainStorage, nullptr);
+    EXPECT_EQ(poolAllocator->getMainStorage(), nullptr);
 }
 
 using AggregatedSmallBuffersEnabledTestDoNotRunSetup = AggregatedSmallBuffersTestTemplate<1, false, false>;
@@ -369,7 +548,7 @@ TEST_F(AggregatedSmallBuffersEnabledTestDoNotRunSetup, givenAggregatedSmallBuffe
     DebugManager.flags.PrintDriverDiagnostics.set(1);
     setUpImpl();
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(poolAllocator->getMainStorage(), nullptr);
     ASSERT_NE(context->driverDiagnostics, nullptr);
     std::string output = testing::internal::GetCapturedStdout();
     EXPECT_EQ(0u, output.size());
@@ -413,7 +592,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenNoBufferCreatedWhenReleasingCo
 }
 
 TEST_F(AggregatedSmallBuffersEnabledApiTest, givenNotSmallBufferWhenCreatingBufferThenDoNotUsePool) {
-    size = PoolAllocator::smallBufferThreshold + 1;
+    size = PoolAllocator::largestPooledBufferSize + 1;
     cl_mem buffer = clCreateBuffer(clContext, flags, size, hostPtr, &retVal);
     EXPECT_EQ(retVal, CL_SUCCESS);
     ASSERT_NE(buffer, nullptr);
@@ -438,7 +617,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenSmallBufferWhenCreatingBufferT
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->getMainStorage());
 
     retVal = clReleaseMemObject(smallBuffer);
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -459,7 +638,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenSmallBufferWhenCreatingBufferW
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->getMainStorage());
 
     retVal = clReleaseMemObject(smallBuffer);
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -481,7 +660,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenSmallBufferWhenCreatingBufferW
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->getMainStorage());
 
     retVal = clReleaseMemObject(smallBuffer);
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -518,7 +697,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenBufferFromPoolWhenGetMemObjInf
 TEST_F(AggregatedSmallBuffersEnabledApiTest, givenSubBufferNotFromPoolAndAggregatedSmallBuffersEnabledWhenReleaseMemObjectCalledThenItSucceeds) {
     DebugManagerStateRestore restore;
     DebugManager.flags.ExperimentalSmallBufferPoolAllocator.set(0);
-    size_t size = PoolAllocator::smallBufferThreshold + 1;
+    size_t size = PoolAllocator::largestPooledBufferSize + 1;
 
     cl_mem largeBuffer = clCreateBuffer(clContext, flags, size, hostPtr, &retVal);
     ASSERT_EQ(retVal, CL_SUCCESS);
@@ -556,7 +735,7 @@ TEST_F(AggregatedSmallBuffersEnabledApiTest, givenCopyHostPointerWhenCreatingBuf
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->getMainStorage());
 
     // check that data has been copied
     auto address = asBuffer->getCpuAddress();
@@ -582,7 +761,7 @@ TEST_F(AggregatedSmallBuffersSubBufferApiTest, givenBufferFromPoolWhenCreateSubB
     ASSERT_NE(buffer, nullptr);
     MockBuffer *mockBuffer = static_cast<MockBuffer *>(buffer);
     EXPECT_GT(mockBuffer->offset, 0u);
-    EXPECT_EQ(ptrOffset(poolAllocator->mainStorage->getCpuAddress(), mockBuffer->getOffset()), mockBuffer->getCpuAddress());
+    EXPECT_EQ(ptrOffset(poolAllocator->getMainStorage()->getCpuAddress(), mockBuffer->getOffset()), mockBuffer->getCpuAddress());
 
     cl_buffer_region region{};
     region.size = 1;
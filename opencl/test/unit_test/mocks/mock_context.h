@@ -55,9 +55,20 @@ class MockContext : public Context {
 
     class MockBufferPoolAllocator : public BufferPoolAllocator {
       public:
-        using BufferPoolAllocator::chunkAllocator;
+        using BufferPoolAllocator::bufferPools;
+        using BufferPoolAllocator::getSizeClass;
         using BufferPoolAllocator::isAggregatedSmallBuffersEnabled;
-        using BufferPoolAllocator::mainStorage;
+        using BufferPoolAllocator::poolsTotalSize;
+
+        uint32_t getPoolsCount(size_t sizeClass = 0u) const {
+            return bufferPools[sizeClass].count.load();
+        }
+        Buffer *getMainStorage(size_t sizeClass = 0u, uint32_t poolIndex = 0u) const {
+            return poolIndex < getPoolsCount(sizeClass) ? bufferPools[sizeClass].pools[poolIndex].mainStorage.load() : nullptr;
+        }
+        HeapAllocator *getChunkAllocator(size_t sizeClass = 0u, uint32_t poolIndex = 0u) const {
+            return poolIndex < getPoolsCount(sizeClass) ? bufferPools[sizeClass].pools[poolIndex].chunkAllocator.get() : nullptr;
+        }
     };
 
   private:
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,12 @@
 #pragma once
 
 #include "shared/offline_compiler/source/multi_command.h"
+#include "shared/offline_compiler/source/ocloc_error_code.h"
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
+#include <map>
 #include <optional>
 #include <string>
 
@@ -20,6 +23,8 @@ class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
     using MultiCommand::lines;
+    using MultiCommand::outputFile;
+    using MultiCommand::parallelBuilds;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
@@ -39,20 +44,28 @@ class MockMultiCommand : public MultiCommand {
 
     ~MockMultiCommand() override = default;
 
-    int singleBuild(const std::vector<std::string> &args) override {
+    int singleBuild(BuildCommand &command) override {
         ++singleBuildCalledCount;
 
         if (callBaseSingleBuild) {
-            return MultiCommand::singleBuild(args);
+            return MultiCommand::singleBuild(command);
         }
 
-        return OclocErrorCode::SUCCESS;
+        if (printInSingleBuild) {
+            argHelper->printf("Building %s\n", command.outFileName.c_str());
+        }
+        command.outputFileEntry = command.outFileName + "\n";
+
+        const auto retVal = singleBuildRetVals.find(command.outFileName);
+        return retVal != singleBuildRetVals.end() ? retVal->second : OclocErrorCode::SUCCESS;
     }
 
     std::map<std::string, std::string> filesMap{};
+    std::map<std::string, int> singleBuildRetVals{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
-    int singleBuildCalledCount{0};
+    std::atomic<int> singleBuildCalledCount{0};
     bool callBaseSingleBuild{true};
+    bool printInSingleBuild{false};
 };
 
 } // namespace NEO
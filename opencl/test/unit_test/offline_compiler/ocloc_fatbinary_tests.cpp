@@ -1474,6 +1474,123 @@ TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArch
     ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(expectedArchivePath));
 }
 
+TEST_F(OclocFatBinaryTest, givenParallelBuildsFlagWhenBuildingFatbinaryThenArchiveIsSameAsForSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef() = MessagePrinter{true};
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.insert(args.begin() + 1, {"-j", "2"});
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenParallelBuildsFlagRepeatedWhenBuildingFatbinaryThenEveryOccurrenceIsStrippedFromTargetCommands) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-j",
+        "2",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices,
+        "-j",
+        "2"};
+
+    mockArgHelper.getPrinterRef() = MessagePrinter{true};
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    EXPECT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    EXPECT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+}
+
+TEST_F(OclocFatBinaryTest, givenParallelBuildsFlagWhenBuildingFatbinaryThenMessagesArePrintedInOrderOfTargets) {
+    auto enabledProductsAcronyms = mockArgHelper.productConfigHelper->getRepresentativeProductAcronyms();
+    if (enabledProductsAcronyms.size() < 2) {
+        GTEST_SKIP();
+    }
+    const auto firstTarget = enabledProductsAcronyms[0].str();
+    const auto secondTarget = enabledProductsAcronyms[1].str();
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-j",
+        "2",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        firstTarget + "," + secondTarget};
+
+    ::testing::internal::CaptureStdout();
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    const auto output{::testing::internal::GetCapturedStdout()};
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+
+    const auto firstTargetMessage = output.find("Build succeeded for : " + firstTarget + ".\n");
+    const auto secondTargetMessage = output.find("Build succeeded for : " + secondTarget + ".\n");
+    ASSERT_NE(std::string::npos, firstTargetMessage);
+    ASSERT_NE(std::string::npos, secondTargetMessage);
+    EXPECT_LT(firstTargetMessage, secondTargetMessage);
+}
+
+TEST_F(OclocFatBinaryTest, givenInvalidParallelBuildsValueWhenBuildingFatbinaryThenErrorIsReported) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    for (const std::string value : {"abc", "-1", ""}) {
+        const std::vector<std::string> args = {
+            "ocloc",
+            "-file",
+            spirvFilename,
+            "-j",
+            value,
+            "-device",
+            devices};
+
+        ::testing::internal::CaptureStdout();
+        const auto result = buildFatBinary(args, &mockArgHelper);
+        const auto output{::testing::internal::GetCapturedStdout()};
+
+        EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+        EXPECT_EQ("Error! Invalid value for -j : " + value + "\n", output);
+    }
+}
+
 TEST_F(OclocFatBinaryTest, givenSpirvInputAndExcludeIrFlagWhenFatBinaryIsRequestedThenArchiveDoesNotContainGenericIrFile) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
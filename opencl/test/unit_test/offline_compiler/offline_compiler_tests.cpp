@@ -390,6 +390,12 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run concurrently.
+                                0 uses one job per hardware thread.
+                                Default is 1 (builds run in sequence).
+                                Logs and output file list entries are
+                                always emitted in the order of commands.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -475,6 +481,116 @@ TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunnin
     EXPECT_EQ(expectedOutput, output);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenParallelBuildsWhenRunningBuildsThenLogsReturnValuesAndOutputFileListAreInCommandOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.printInSingleBuild = true;
+    mockMultiCommand.parallelBuilds = 3u;
+    mockMultiCommand.singleBuildRetVals["build_no_3"] = OclocErrorCode::INVALID_FILE;
+
+    const std::string validLine{"-file test_files/copybuffer.cl -out_dir SomeOutputDirectory -device " + gEnvironment->devicePrefix};
+    for (int i = 0; i < 4; i++) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(4, mockMultiCommand.singleBuildCalledCount);
+
+    const std::vector<int> expectedRetValues{OclocErrorCode::SUCCESS, OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE,
+                                             OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
+    EXPECT_EQ(expectedRetValues, mockMultiCommand.retValues);
+
+    const auto expectedOutput{"Command number 1: \n"
+                              "Building build_no_1\n"
+                              "Command number 2: \n"
+                              "Building build_no_2\n"
+                              "Command number 3: \n"
+                              "Building build_no_3\n"
+                              "Command number 4: \n"
+                              "Building build_no_4\n"
+                              "One of the quotes is open in build number 5\n"};
+    EXPECT_EQ(expectedOutput, output);
+
+    const auto expectedOutputFileList{"build_no_1\nbuild_no_2\nbuild_no_3\nbuild_no_4\n"};
+    EXPECT_EQ(expectedOutputFileList, mockMultiCommand.outputFile.str());
+}
+
+TEST(MessagePrinterTest, GivenCapturedMessagesWhenSuppressingCapturedMessagesThenOnlyCurrentCaptureIsSilenced) {
+    MessagePrinter printer{};
+    EXPECT_FALSE(MessagePrinter::suppressCapturedMessages());
+
+    std::string log;
+    {
+        MessagePrinter::ScopedCapture capture(log);
+        printer.printf("before\n");
+        EXPECT_TRUE(MessagePrinter::suppressCapturedMessages());
+        printer.printf("after %d\n", 1);
+
+        std::string nestedLog;
+        {
+            MessagePrinter::ScopedCapture nestedCapture(nestedLog);
+            printer.printf("nested\n");
+        }
+        EXPECT_EQ("nested\n", nestedLog);
+        printer.printf("after nested\n");
+    }
+    EXPECT_EQ("before\n", log);
+    EXPECT_FALSE(printer.isSuppressed());
+
+    std::string nextLog;
+    {
+        MessagePrinter::ScopedCapture capture(nextLog);
+        printer.printf("next\n");
+    }
+    EXPECT_EQ("next\n", nextLog);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenParallelBuildsArgumentWhenInitializingThenNumberOfParallelBuildsIsSet) {
+    MockMultiCommand mockMultiCommand{};
+
+    mockMultiCommand.uniqueHelper->callBaseFileExists = false;
+    mockMultiCommand.uniqueHelper->callBaseReadFileToVectorOfStrings = false;
+    mockMultiCommand.uniqueHelper->shouldReturnEmptyVectorOfStrings = true;
+    mockMultiCommand.filesMap["commands.txt"] = "";
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "4"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OclocErrorCode::INVALID_FILE, result);
+    EXPECT_EQ(4u, mockMultiCommand.parallelBuilds);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidParallelBuildsValueWhenInitializingThenErrorIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "two"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+    EXPECT_NE(std::string::npos, output.find("Invalid value for -j : two\n"));
+}
+
 TEST(MultiCommandWhiteboxTest, GivenArgsWithQuietModeAndEmptyMulticommandFileWhenInitializingThenQuietFlagIsSetAndErrorIsReturned) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.quiet = false;
@@ -904,6 +1020,51 @@ TEST_F(OfflineCompilerTests, givenConfigFlagWhenParsingCommandLineThenCorrectVal
     EXPECT_EQ(mockOfflineCompiler.hwInfoConfig, config);
 }
 
+TEST_F(OfflineCompilerTests, givenParallelBuildsFlagWhenParsingCommandLineThenItIsAcceptedAndIgnored) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-j",
+        "4",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+    ::testing::internal::CaptureStdout();
+    const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OclocErrorCode::SUCCESS, result);
+    EXPECT_EQ(std::string::npos, output.find("Invalid option"));
+    EXPECT_EQ(clFiles + "copybuffer.cl", mockOfflineCompiler.inputFile);
+}
+
+TEST_F(OfflineCompilerTests, givenVeryQuietFlagAndCapturedMessagesWhenParsingCommandLineThenOnlyCapturedMessagesAreSuppressed) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-qq"};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+    std::string log;
+    {
+        MessagePrinter::ScopedCapture capture(log);
+        const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+        EXPECT_EQ(OclocErrorCode::SUCCESS, result);
+        mockOfflineCompiler.argHelper->printf("Suppressed message\n");
+    }
+
+    EXPECT_TRUE(mockOfflineCompiler.quiet);
+    EXPECT_FALSE(mockOfflineCompiler.argHelper->getPrinterRef().isSuppressed());
+    EXPECT_TRUE(log.empty());
+}
+
 TEST_F(OfflineCompilerTests, givenIncorrectConfigFlagWhenParsingCommandLineThenErrorLogIsPrintedAndFailureIsReturned) {
     std::string configStr = "1xabcf";
     const std::vector<std::string> argv = {
@@ -961,7 +961,7 @@ HWTEST_F(ProfilingWithPerfCountersTests, GivenCommandQueueWithProfilingPerfCount
 
 template <typename TagType>
 struct FixedGpuAddressTagAllocator : MockTagAllocator<TagType> {
-    using TagAllocator<TagType>::usedTags;
+    using TagAllocator<TagType>::usedTagsCount;
     using TagAllocator<TagType>::deferredTags;
 
     struct MockTagNode : TagNode<TagType> {
@@ -1026,7 +1026,7 @@ HWTEST_F(ProfilingWithPerfCountersTests, givenTimestampPacketsEnabledWhenEnqueue
 
     myCmdQ->enqueueKernel(kernel->mockKernel, 1, globalOffsets, workItems, nullptr, 0, nullptr, &event);
 
-    EXPECT_EQ(!!myCmdQ->getTimestampPacketContainer(), mockAllocator->usedTags.peekIsEmpty());
+    EXPECT_EQ(!!myCmdQ->getTimestampPacketContainer(), 0u == mockAllocator->usedTagsCount);
     EXPECT_TRUE(mockAllocator->deferredTags.peekIsEmpty());
 
     clReleaseEvent(event);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -38,8 +39,50 @@ class MessagePrinter {
   public:
     MessagePrinter() = default;
     MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
+    MessagePrinter(MessagePrinter &&other) noexcept : ss(std::move(other.ss)), suppressMessages(other.suppressMessages) {}
+    MessagePrinter &operator=(MessagePrinter &&other) noexcept {
+        ss = std::move(other.ss);
+        suppressMessages = other.suppressMessages;
+        return *this;
+    }
+
+    // Redirects messages printed by the current thread into a buffer for the lifetime
+    // of the object, so that output of concurrent jobs can be replayed in order.
+    class ScopedCapture {
+      public:
+        ScopedCapture(std::string &buffer) : previousBuffer(capturedMessages), previousSuppressed(capturedMessagesSuppressed) {
+            capturedMessages = &buffer;
+            capturedMessagesSuppressed = false;
+        }
+        ~ScopedCapture() {
+            capturedMessages = previousBuffer;
+            capturedMessagesSuppressed = previousSuppressed;
+        }
+        ScopedCapture(const ScopedCapture &) = delete;
+        ScopedCapture &operator=(const ScopedCapture &) = delete;
+
+      protected:
+        std::string *previousBuffer = nullptr;
+        bool previousSuppressed = false;
+    };
+
+    // Drops further messages of the current thread's capture, returns false when nothing is captured.
+    static bool suppressCapturedMessages() {
+        if (capturedMessages == nullptr) {
+            return false;
+        }
+        capturedMessagesSuppressed = true;
+        return true;
+    }
 
     void printf(const char *message) {
+        if (capturedMessages) {
+            if (!capturedMessagesSuppressed) {
+                capturedMessages->append(message);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mtx);
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -48,6 +91,13 @@ class MessagePrinter {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        if (capturedMessages) {
+            if (!capturedMessagesSuppressed) {
+                capturedMessages->append(stringFormat(format, std::forward<Args>(args)...));
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mtx);
         if (!suppressMessages) {
             ::printf(format, std::forward<Args>(args)...);
         }
@@ -73,6 +123,9 @@ class MessagePrinter {
         return outputString.c_str();
     }
 
+    static inline thread_local std::string *capturedMessages = nullptr;
+    static inline thread_local bool capturedMessagesSuppressed = false;
     std::stringstream ss;
+    std::mutex mtx;
     bool suppressMessages = false;
 };
@@ -11,10 +11,15 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <memory>
+#include <thread>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+int MultiCommand::singleBuild(BuildCommand &command) {
+    const auto &args = command.args;
     int retVal = OclocErrorCode::SUCCESS;
 
     if (requestedFatBinary(args, argHelper)) {
@@ -29,7 +34,7 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
                 argHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        command.outFileName += ".bin";
     }
     if (retVal == OclocErrorCode::SUCCESS) {
         if (!quiet)
@@ -39,11 +44,11 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OclocErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        command.outputFileEntry = getCurrentDirectoryOwn(command.outDirForBuilds) + command.outFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        command.outputFileEntry = "Unsuccesful build";
     }
-    outputFile << '\n';
+    command.outputFileEntry += '\n';
 
     return retVal;
 }
@@ -105,6 +110,17 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            const auto &value = args[++argIndex];
+            if (value.empty() || !std::all_of(value.begin(), value.end(), ::isdigit)) {
+                argHelper->printf("Invalid value for -j : %s\n", value.c_str());
+                printHelp();
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            parallelBuilds = std::strtoul(value.c_str(), nullptr, 10);
+            if (parallelBuilds == 0u) {
+                parallelBuilds = std::max(std::thread::hardware_concurrency(), 1u);
+            }
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -133,12 +149,14 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    std::vector<BuildCommand> commands(lines.size());
     for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+        auto &command = commands[i];
+        MessagePrinter::ScopedCapture capture(command.log);
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OclocErrorCode::SUCCESS) {
-            retValues.push_back(retVal);
+        command.args = {argZero};
+        command.retVal = splitLineInSeparateArgs(command.args, lines[i], i);
+        if (command.retVal != OclocErrorCode::SUCCESS) {
             continue;
         }
 
@@ -146,9 +164,48 @@ void MultiCommand::runBuilds(const std::string &argZero) {
             argHelper->printf("Command number %zu: \n", i + 1);
         }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+        addAdditionalOptionsToSingleCommandLine(command.args, i);
+        command.outDirForBuilds = outDirForBuilds;
+        command.outFileName = outFileName;
+        command.readyToBuild = true;
+    }
+
+    if (parallelBuilds > 1u) {
+        runBuildsInParallel(commands);
+    }
+
+    for (auto &command : commands) {
+        if (command.log.empty() == false) {
+            argHelper->printf(command.log.c_str());
+        }
+        if (command.readyToBuild && parallelBuilds <= 1u) {
+            command.retVal = singleBuild(command);
+        }
+        retValues.push_back(command.retVal);
+        outputFile << command.outputFileEntry;
+    }
+}
+
+void MultiCommand::runBuildsInParallel(std::vector<BuildCommand> &commands) {
+    std::atomic<size_t> nextCommand{0u};
+    auto buildCommands = [&]() {
+        for (auto commandIndex = nextCommand++; commandIndex < commands.size(); commandIndex = nextCommand++) {
+            auto &command = commands[commandIndex];
+            if (command.readyToBuild) {
+                MessagePrinter::ScopedCapture capture(command.log);
+                command.retVal = singleBuild(command);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(parallelBuilds, commands.size());
+    for (size_t i = 1; i < workersCount; i++) {
+        workers.emplace_back(buildCommands);
+    }
+    buildCommands();
+    for (auto &worker : workers) {
+        worker.join();
     }
 }
 
@@ -167,6 +224,12 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run concurrently.
+                                0 uses one job per hardware thread.
+                                Default is 1 (builds run in sequence).
+                                Logs and output file list entries are
+                                always emitted in the order of commands.
+
 )===");
 }
 
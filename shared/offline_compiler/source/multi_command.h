@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,15 +33,26 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct BuildCommand {
+        std::vector<std::string> args;
+        std::string outDirForBuilds;
+        std::string outFileName;
+        std::string outputFileEntry;
+        std::string log;
+        int retVal = 0;
+        bool readyToBuild = false;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int singleBuild(BuildCommand &command);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(std::vector<BuildCommand> &commands);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
@@ -49,6 +60,7 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    size_t parallelBuilds = 1u;
     bool quiet = false;
 };
 } // namespace NEO
@@ -16,6 +16,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -48,6 +49,7 @@ class OclocArgHelper {
   protected:
     std::vector<Source> inputs, headers;
     std::vector<Output *> outputs;
+    std::mutex outputsMutex;
     uint32_t *numOutputs = nullptr;
     char ***nameOutputs = nullptr;
     uint8_t ***dataOutputs = nullptr;
@@ -59,6 +61,7 @@ class OclocArgHelper {
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         outputs.push_back(new Output(filename, data, size));
     }
 
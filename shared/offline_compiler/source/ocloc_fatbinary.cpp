@@ -21,9 +21,13 @@
 #include "igfxfmid.h"
 #include "platforms.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <thread>
 
 namespace NEO {
 bool requestedFatBinary(const std::vector<std::string> &args, OclocArgHelper *helper) {
@@ -244,23 +248,27 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
 
     if (retVal == 0) {
         retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+        return appendTargetToFatBinary(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
+    }
+    return retVal;
+}
+
+int appendTargetToFatBinary(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
-    if (retVal) {
-        return retVal;
+    if (buildRetVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), buildRetVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return buildRetVal;
     }
 
     std::string productConfig("");
@@ -271,7 +279,30 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
-    return retVal;
+    return buildRetVal;
+}
+
+std::vector<int> buildTargetsInParallel(const std::vector<std::unique_ptr<OfflineCompiler>> &compilers, size_t parallelBuilds, std::vector<std::string> &targetLogs) {
+    std::vector<int> retVals(compilers.size(), OclocErrorCode::SUCCESS);
+    targetLogs.assign(compilers.size(), std::string{});
+    std::atomic<size_t> nextTarget{0u};
+    auto buildTargets = [&]() {
+        for (auto targetIndex = nextTarget++; targetIndex < compilers.size(); targetIndex = nextTarget++) {
+            MessagePrinter::ScopedCapture capture(targetLogs[targetIndex]);
+            retVals[targetIndex] = buildWithSafetyGuard(compilers[targetIndex].get());
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(parallelBuilds, compilers.size());
+    for (size_t i = 1; i < workersCount; i++) {
+        workers.emplace_back(buildTargets);
+    }
+    buildTargets();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return retVals;
 }
 
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
@@ -282,6 +313,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    size_t parallelBuilds = 1u;
+    std::vector<size_t> parallelBuildsArgIndices;
 
     std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
@@ -307,6 +340,26 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            const auto &value = args[argIndex + 1];
+            if (value.empty() || !std::all_of(value.begin(), value.end(), ::isdigit)) {
+                argHelper->printf("Error! Invalid value for -j : %s\n", value.c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            parallelBuilds = std::strtoul(value.c_str(), nullptr, 10);
+            if (parallelBuilds == 0u) {
+                parallelBuilds = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+            parallelBuildsArgIndices.push_back(argIndex);
+            ++argIndex;
+        }
+    }
+
+    // -j is not an option of a single target build, drop every occurrence
+    for (auto it = parallelBuildsArgIndices.rbegin(); it != parallelBuildsArgIndices.rend(); ++it) {
+        argsCopy.erase(argsCopy.begin() + *it, argsCopy.begin() + *it + 2);
+        if (deviceArgIndex != static_cast<size_t>(-1) && deviceArgIndex > *it) {
+            deviceArgIndex -= 2;
         }
     }
 
@@ -322,24 +375,59 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
 
     Ar::ArEncoder fatbinary(true);
     std::vector<ConstStringRef> targetProducts;
-    targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    const auto deviceArg = argsCopy[deviceArgIndex];
+    targetProducts = getTargetProductsForFatbinary(ConstStringRef(deviceArg), argHelper);
     if (targetProducts.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", deviceArg.c_str());
         return 1;
     }
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
+    if (parallelBuilds > 1u && targetProducts.size() > 1u) {
+        std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+        compilers.reserve(targetProducts.size());
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            compilers.emplace_back(OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper));
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+        }
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OclocErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+        // Targets are built concurrently, but logs and archive entries are emitted in
+        // the requested order so the output does not depend on scheduling.
+        std::vector<std::string> targetLogs;
+        const auto buildRetVals = buildTargetsInParallel(compilers, parallelBuilds, targetLogs);
+        int firstError = OclocErrorCode::SUCCESS;
+        for (size_t i = 0; i < targetProducts.size(); i++) {
+            if (targetLogs[i].empty() == false) {
+                argHelper->printf("%s", targetLogs[i].c_str());
+            }
+            argsCopy[deviceArgIndex] = targetProducts[i].str();
+            auto retVal = appendTargetToFatBinary(buildRetVals[i], argsCopy, pointerSizeInBits, fatbinary, compilers[i].get(), argHelper, targetProducts[i].str());
+            if (retVal && firstError == OclocErrorCode::SUCCESS) {
+                firstError = retVal;
+            }
+        }
+        if (firstError) {
+            return firstError;
         }
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
 
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
-        if (retVal) {
-            return retVal;
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
         }
     }
 
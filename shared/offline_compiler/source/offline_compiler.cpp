@@ -714,7 +714,10 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
         } else if ("-q" == currArg) {
             quiet = true;
         } else if ("-qq" == currArg) {
-            argHelper->getPrinterRef() = MessagePrinter(true);
+            // commands of parallel multi builds print into their own capture, silence only that one
+            if (!MessagePrinter::suppressCapturedMessages()) {
+                argHelper->getPrinterRef() = MessagePrinter(true);
+            }
             quiet = true;
         } else if ("-spv_only" == currArg) {
             onlySpirV = true;
@@ -741,6 +744,9 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-allow_caching" == currArg) {
             allowCaching = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // number of concurrently built targets, only meaningful for fatbinary builds
+            argIndex++;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = INVALID_COMMAND_LINE;
@@ -916,6 +922,13 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                 <device_type> can be: %s
                                 - can be single target device.
 
+  -j <jobs>                     Number of targets compiled concurrently when
+                                multiple target devices are provided.
+                                0 uses one job per hardware thread.
+                                Default is 1 (targets compiled in sequence).
+                                Device binaries are always stored in the
+                                fatbinary archive in the order of targets.
+
   -output <filename>            Optional output file base name.
                                 Default is input file's base name.
                                 This base name will be used for all output
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,18 +8,24 @@
 #pragma once
 #include "shared/source/helpers/abort.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
-        struct sigaction sigact;
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (activeGuards++ > 0) {
+            return;
+        }
+        struct sigaction sigact = {};
 
         sigact.sa_sigaction = sigAction;
         sigact.sa_flags = SA_RESTART | SA_SIGINFO;
@@ -28,6 +34,10 @@ class SafetyGuardLinux {
     }
 
     ~SafetyGuardLinux() {
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (--activeGuards > 0) {
+            return;
+        }
         if (previousSigSegvAction.sa_sigaction) {
             sigaction(SIGSEGV, &previousSigSegvAction, NULL);
         }
@@ -72,6 +82,11 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction = {};
-    struct sigaction previousSigIllvAction = {};
+
+    // Guards may be active on several threads at once (parallel fatbinary builds),
+    // so handlers are installed by the first guard and restored by the last one.
+    static inline std::mutex handlersMutex;
+    static inline uint32_t activeGuards = 0u;
+    static inline struct sigaction previousSigSegvAction = {};
+    static inline struct sigaction previousSigIllvAction = {};
 };
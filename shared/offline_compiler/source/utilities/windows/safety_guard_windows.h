@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,7 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardWindows {
   public:
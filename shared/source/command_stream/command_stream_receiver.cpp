@@ -415,6 +415,7 @@ bool CommandStreamReceiver::checkGpuHangDetected(TimeType currentTime, TimeType
 WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *pollAddress, const WaitParams &params, TaskCountType taskCountToWait) {
     std::chrono::high_resolution_clock::time_point waitStartTime, lastHangCheckTime, currentTime;
     int64_t timeDiff = 0;
+    int64_t timeSinceWaitStarted = 0;
 
     TaskCountType latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
@@ -428,7 +429,7 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
+            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait, timeSinceWaitStarted)) {
                 break;
             }
 
@@ -437,8 +438,9 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
                 return WaitStatus::GpuHang;
             }
 
+            timeSinceWaitStarted = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
             if (params.enableTimeout) {
-                timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
+                timeDiff = timeSinceWaitStarted;
             }
         }
 
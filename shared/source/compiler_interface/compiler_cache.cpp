@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,12 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
@@ -19,17 +20,21 @@
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+std::array<std::mutex, CompilerCache::hashAccessMtxCount> CompilerCache::hashAccessMtxs;
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -41,24 +46,26 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(safePodCast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
     hash.update("----", 4);
 
-    const auto featureTableHashStr = std::to_string(hwInfo.featureTable.asHash());
-    hash.update(featureTableHashStr.c_str(), featureTableHashStr.length());
+    const uint64_t featureTableHash = hwInfo.featureTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&featureTableHash), sizeof(featureTableHash));
     hash.update("----", 4);
 
-    const auto workaroundTableHashStr = std::to_string(hwInfo.workaroundTable.asHash());
-    hash.update(workaroundTableHashStr.c_str(), workaroundTableHashStr.length());
+    const uint64_t workaroundTableHash = hwInfo.workaroundTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&workaroundTableHash), sizeof(workaroundTableHash));
 
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
 
     if (DebugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
         std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".input";
-        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        std::lock_guard<std::mutex> lock(getHashAccessMtx(stream.str()));
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
             NEO::IoFunctions::fprintf(fp, "---- input ----\n");
@@ -107,22 +114,149 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (config.inMemoryCacheSize != 0u) {
+        InMemoryCompilerCache::getInstance().increaseMemoryBudget(config.inMemoryCacheSize);
+    }
+};
+
+std::mutex &CompilerCache::getHashAccessMtx(const std::string &kernelFileHash) {
+    return hashAccessMtxs[std::hash<std::string>{}(kernelFileHash) % hashAccessMtxCount];
+}
+
+bool CompilerCache::reserveCacheSpace(const std::string &filePath, size_t binarySize, size_t &replacedFileSize) {
+    replacedFileSize = 0u;
+    if (config.cacheSize == 0u) {
+        return true;
+    }
+    if (binarySize > config.cacheSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(cachedFilesSizeMtx);
+    if (!cachedFilesSizeKnown) {
+        cachedFilesSize = 0u;
+        for (const auto &file : getCachedFiles()) {
+            cachedFilesSize += file.size;
+        }
+        cachedFilesSizeKnown = true;
+    }
+
+    // binary with the same hash is replaced, so its current size no longer counts against the limit
+    replacedFileSize = getCachedFileSize(filePath);
+    cachedFilesSize -= std::min(cachedFilesSize, replacedFileSize);
+
+    if (cachedFilesSize + binarySize > config.cacheSize) {
+        evictCache(filePath, binarySize);
+    }
+    cachedFilesSize += binarySize;
+    return true;
+}
+
+void CompilerCache::releaseCacheSpace(size_t binarySize, size_t replacedFileSize) {
+    if (config.cacheSize == 0u) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cachedFilesSizeMtx);
+    cachedFilesSize -= std::min(cachedFilesSize, binarySize);
+    cachedFilesSize += replacedFileSize;
+}
+
+void CompilerCache::evictCache(const std::string &replacedFilePath, size_t bytesToFit) {
+    const auto currentTime = std::time(nullptr);
+    auto files = getCachedFiles();
+    files.erase(std::remove_if(files.begin(), files.end(), [&](const CachedFileInfo &file) {
+                    const bool isBeingWritten = file.isTemporary && currentTime - file.lastAccessTime < temporaryFileMinEvictionAge;
+                    return file.path == replacedFilePath || isBeingWritten;
+                }),
+                files.end());
+    std::sort(files.begin(), files.end(), [](const CachedFileInfo &lhs, const CachedFileInfo &rhs) {
+        return lhs.lastAccessTime < rhs.lastAccessTime;
+    });
+
+    // other processes may share cache directory, so tracked size is refreshed on every eviction
+    cachedFilesSize = 0u;
+    for (const auto &file : files) {
+        cachedFilesSize += file.size;
+    }
+
+    const size_t targetSize = config.cacheSize - config.cacheSize / evictionHeadroomDivisor;
+    for (const auto &file : files) {
+        if (cachedFilesSize + bytesToFit <= targetSize) {
+            break;
+        }
+        if (removeCachedFile(file.path)) {
+            cachedFilesSize -= file.size;
+        }
+    }
+}
+
+bool CompilerCache::removeCachedFile(const std::string &filePath) {
+    return 0 == std::remove(filePath.c_str());
+}
+
+bool CompilerCache::writeBinaryAtomically(const std::string &filePath, const char *pBinary, size_t binarySize) {
+    // temporary file is created by fopen, so it gets default permissions (0666 masked by umask) and cache directory may be shared between users
+    auto tmpFilePath = getTemporaryFilePath(filePath);
+    auto fp = NEO::IoFunctions::fopenPtr(tmpFilePath.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    auto bytesWritten = NEO::IoFunctions::fwritePtr(pBinary, sizeof(char), binarySize, fp);
+    auto closeResult = NEO::IoFunctions::fclosePtr(fp);
+
+    if (bytesWritten != binarySize || closeResult != 0 || !renameCachedFile(tmpFilePath, filePath)) {
+        removeCachedFile(tmpFilePath);
+        return false;
+    }
+    return true;
+}
 
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
     std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+
+    if (config.inMemoryCacheSize != 0u) {
+        InMemoryCompilerCache::getInstance().store(kernelFileHash, pBinary, binarySize);
+    }
+
+    std::lock_guard<std::mutex> lock(getHashAccessMtx(kernelFileHash));
+    size_t replacedFileSize = 0u;
+    if (!reserveCacheSpace(filePath, binarySize, replacedFileSize)) {
+        return false;
+    }
+
+    if (!writeBinaryAtomically(filePath, pBinary, binarySize)) {
+        releaseCacheSpace(binarySize, replacedFileSize);
+        return false;
+    }
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
+    if (config.inMemoryCacheSize != 0u) {
+        auto binary = InMemoryCompilerCache::getInstance().load(kernelFileHash, cachedBinarySize);
+        if (binary != nullptr) {
+            return binary;
+        }
+    }
+
     std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    // binaries are published with atomic rename, so readers never observe partially written files
+    auto binary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    if (binary != nullptr) {
+        if (config.cacheSize != 0u) {
+            updateLastAccessTime(filePath);
+        }
+        if (config.inMemoryCacheSize != 0u) {
+            InMemoryCompilerCache::getInstance().store(kernelFileHash, binary.get(), cachedBinarySize);
+        }
+    }
+    return binary;
 }
 
 } // namespace NEO
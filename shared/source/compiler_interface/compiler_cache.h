@@ -9,10 +9,13 @@
 
 #include "shared/source/utilities/arrayref.h"
 
+#include <array>
 #include <cstdint>
+#include <ctime>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
@@ -21,6 +24,8 @@ struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u;         // upper bound for total size of cached binaries in bytes, 0 means unlimited
+    size_t inMemoryCacheSize = 0u; // budget of process-wide in-memory tier in bytes, 0 means disabled
 };
 
 class CompilerCache {
@@ -40,7 +45,38 @@ class CompilerCache {
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
 
   protected:
-    static std::mutex cacheAccessMtx;
+    struct CachedFileInfo {
+        std::string path;
+        size_t size = 0u;
+        time_t lastAccessTime = 0;
+        bool isTemporary = false; // left behind by an interrupted write or still being written
+    };
+
+    // when eviction is needed, cache is trimmed to (cacheSize - cacheSize / evictionHeadroomDivisor)
+    // so that subsequent stores do not rescan cache directory every time
+    static constexpr size_t evictionHeadroomDivisor = 4u;
+    static constexpr size_t hashAccessMtxCount = 64u;
+    // younger temporary files may still be written by another process, older ones are evicted like cached binaries
+    static constexpr time_t temporaryFileMinEvictionAge = 10 * 60;
+
+    std::mutex &getHashAccessMtx(const std::string &kernelFileHash);
+    bool reserveCacheSpace(const std::string &filePath, size_t binarySize, size_t &replacedFileSize);
+    void releaseCacheSpace(size_t binarySize, size_t replacedFileSize);
+    void evictCache(const std::string &replacedFilePath, size_t bytesToFit);
+    MOCKABLE_VIRTUAL bool writeBinaryAtomically(const std::string &filePath, const char *pBinary, size_t binarySize);
+    MOCKABLE_VIRTUAL bool removeCachedFile(const std::string &filePath);
+
+    // os specific
+    std::string getTemporaryFilePath(const std::string &filePath);
+    MOCKABLE_VIRTUAL bool renameCachedFile(const std::string &oldFilePath, const std::string &newFilePath);
+    MOCKABLE_VIRTUAL size_t getCachedFileSize(const std::string &filePath);
+    MOCKABLE_VIRTUAL void updateLastAccessTime(const std::string &filePath);
+    MOCKABLE_VIRTUAL std::vector<CachedFileInfo> getCachedFiles();
+
+    static std::array<std::mutex, hashAccessMtxCount> hashAccessMtxs;
     CompilerCacheConfig config;
+    std::mutex cachedFilesSizeMtx;
+    size_t cachedFilesSize = 0u;
+    bool cachedFilesSizeKnown = false;
 };
 } // namespace NEO
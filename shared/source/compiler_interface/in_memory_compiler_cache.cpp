@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+InMemoryCompilerCache &InMemoryCompilerCache::getInstance() {
+    static InMemoryCompilerCache instance;
+    return instance;
+}
+
+void InMemoryCompilerCache::increaseMemoryBudget(size_t budget) {
+    std::lock_guard<std::mutex> lock(mtx);
+    memoryBudget = std::max(memoryBudget, budget);
+}
+
+size_t InMemoryCompilerCache::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return memoryBudget;
+}
+
+size_t InMemoryCompilerCache::getUsedMemory() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return usedMemory;
+}
+
+bool InMemoryCompilerCache::store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0u) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (binarySize > memoryBudget) {
+        return false;
+    }
+
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it != entriesByHash.end()) {
+        usedMemory -= it->second->binarySize;
+        entries.erase(it->second);
+        entriesByHash.erase(it);
+    }
+
+    evict(binarySize);
+
+    Entry entry;
+    entry.kernelFileHash = kernelFileHash;
+    entry.binary.reset(new char[binarySize]);
+    memcpy(entry.binary.get(), pBinary, binarySize);
+    entry.binarySize = binarySize;
+
+    entries.push_front(std::move(entry));
+    entriesByHash[kernelFileHash] = entries.begin();
+    usedMemory += binarySize;
+    return true;
+}
+
+std::unique_ptr<char[]> InMemoryCompilerCache::load(const std::string &kernelFileHash, size_t &binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it == entriesByHash.end()) {
+        missCount++;
+        binarySize = 0u;
+        return nullptr;
+    }
+    hitCount++;
+
+    entries.splice(entries.begin(), entries, it->second);
+    const auto &entry = *it->second;
+
+    binarySize = entry.binarySize;
+    std::unique_ptr<char[]> binary(new char[entry.binarySize]);
+    memcpy(binary.get(), entry.binary.get(), entry.binarySize);
+    return binary;
+}
+
+void InMemoryCompilerCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    decltype(entriesByHash)().swap(entriesByHash);
+    entries.clear();
+    usedMemory = 0u;
+    memoryBudget = 0u;
+    hitCount = 0u;
+    missCount = 0u;
+}
+
+void InMemoryCompilerCache::evict(size_t bytesToFit) {
+    while (!entries.empty() && usedMemory + bytesToFit > memoryBudget) {
+        auto &leastRecentlyUsed = entries.back();
+        usedMemory -= leastRecentlyUsed.binarySize;
+        entriesByHash.erase(leastRecentlyUsed.kernelFileHash);
+        entries.pop_back();
+    }
+}
+
+} // namespace NEO
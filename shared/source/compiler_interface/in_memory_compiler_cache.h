@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+// Process-wide LRU cache of compiled binaries kept in front of the on-disk CompilerCache.
+// Entries are keyed by the hash returned from CompilerCache::getCachedFileName.
+class InMemoryCompilerCache : NonCopyableOrMovableClass {
+  public:
+    static InMemoryCompilerCache &getInstance();
+
+    void increaseMemoryBudget(size_t budget);
+    size_t getMemoryBudget() const;
+    size_t getUsedMemory() const;
+
+    bool store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &kernelFileHash, size_t &binarySize);
+    void clear();
+
+    uint64_t getHitCount() const { return hitCount; }
+    uint64_t getMissCount() const { return missCount; }
+
+  protected:
+    struct Entry {
+        std::string kernelFileHash;
+        std::unique_ptr<char[]> binary;
+        size_t binarySize = 0u;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evict(size_t bytesToFit);
+
+    mutable std::mutex mtx;
+    EntryList entries; // most recently used first
+    std::unordered_map<std::string, EntryList::iterator> entriesByHash;
+    size_t memoryBudget = 0u;
+    size_t usedMemory = 0u;
+    std::atomic<uint64_t> hitCount{0u};
+    std::atomic<uint64_t> missCount{0u};
+};
+
+} // namespace NEO
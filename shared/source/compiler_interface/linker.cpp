@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -24,7 +25,9 @@
 
 #include "RelocationInfo.h"
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 namespace NEO {
@@ -119,6 +122,8 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
 
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
     outRelocInfo.reserve(numEntries);
+    relocationPlan.symbolIdsPerInstSegment.resize(textRelocations.size());
+    relocationPlan.symbolIdsPerInstSegment[instructionsSegmentId].reserve(outRelocInfo.size() + numEntries);
     for (; relocEntryIt != relocEntryEnd; ++relocEntryIt) {
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
@@ -142,6 +147,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
             relocInfo.type = RelocationInfo::Type::PerThreadPayloadOffset;
             break;
         }
+        relocationPlan.addRelocation(instructionsSegmentId, relocationPlan.internSymbol(relocInfo.symbolName));
         outRelocInfo.push_back(std::move(relocInfo));
     }
     return true;
@@ -155,6 +161,12 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
+    auto symbolId = relocationPlan.internSymbol(relocationInfo.symbolName);
+    addElfTextSegmentRelocation(std::move(relocationInfo), instructionsSegmentId, symbolId);
+}
+
+void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId, uint32_t symbolId) {
+    DEBUG_BREAK_IF(symbolId >= relocationPlan.symbolNames.size() || relocationPlan.symbolNames[symbolId] != relocationInfo.symbolName);
     this->traits.requiresPatchingOfInstructionSegments = true;
 
     if (instructionsSegmentId >= textRelocations.size()) {
@@ -166,6 +178,7 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
 
     relocationInfo.relocationSegment = SegmentType::Instructions;
 
+    relocationPlan.addRelocation(instructionsSegmentId, symbolId);
     outRelocInfo.push_back(std::move(relocationInfo));
 }
 
@@ -222,6 +235,7 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, con
         }
     }
 
+    std::vector<uint32_t> symbolIdsBySymbolTableIndex(elf.getSymbols().size(), RelocationPlan::invalidSymbolId);
     for (auto &reloc : elf.getRelocations()) {
         NEO::LinkerInput::RelocationInfo relocationInfo;
         relocationInfo.offset = reloc.offset;
@@ -248,7 +262,17 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, con
             auto kernelName = name.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
             auto segmentIdIter = nameToSegmentId.find(kernelName);
             if (segmentIdIter != nameToSegmentId.end()) {
-                this->addElfTextSegmentRelocation(relocationInfo, segmentIdIter->second);
+                auto symbolId = RelocationPlan::invalidSymbolId;
+                if (static_cast<size_t>(reloc.symbolTableIndex) < symbolIdsBySymbolTableIndex.size()) {
+                    auto &symbolIdForIndex = symbolIdsBySymbolTableIndex[reloc.symbolTableIndex];
+                    if (symbolIdForIndex == RelocationPlan::invalidSymbolId) {
+                        symbolIdForIndex = relocationPlan.internSymbol(relocationInfo.symbolName);
+                    }
+                    symbolId = symbolIdForIndex;
+                } else {
+                    symbolId = relocationPlan.internSymbol(relocationInfo.symbolName);
+                }
+                this->addElfTextSegmentRelocation(relocationInfo, segmentIdIter->second, symbolId);
                 parseRelocationForExtFuncUsage(relocationInfo, kernelName);
             }
         } else if (nameRef.startsWith(NEO::Elf::SpecialSectionNames::data.data())) {
@@ -283,6 +307,46 @@ void LinkerInput::parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo
     }
 }
 
+uint32_t LinkerInput::RelocationPlan::internSymbol(const std::string &symbolName) {
+    auto [symbolIdIt, inserted] = symbolIds.try_emplace(symbolName, static_cast<uint32_t>(symbolNames.size()));
+    if (inserted) {
+        symbolNames.push_back(symbolName);
+    }
+    return symbolIdIt->second;
+}
+
+void LinkerInput::RelocationPlan::addRelocation(uint32_t instructionsSegmentId, uint32_t symbolId) {
+    if (instructionsSegmentId >= symbolIdsPerInstSegment.size()) {
+        symbolIdsPerInstSegment.resize(instructionsSegmentId + 1);
+    }
+    symbolIdsPerInstSegment[instructionsSegmentId].push_back(symbolId);
+}
+
+bool LinkerInput::RelocationPlan::isValidFor(const RelocationsPerInstSegment &relocations) const {
+    // relocations are only ever appended together with their plan entries, so matching counts mean matching symbols
+    if (symbolIdsPerInstSegment.size() != relocations.size()) {
+        return false;
+    }
+    for (size_t segId = 0; segId < relocations.size(); segId++) {
+        if (symbolIdsPerInstSegment[segId].size() != relocations[segId].size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LinkerInput::RelocationPlan LinkerInput::RelocationPlan::build(const RelocationsPerInstSegment &relocations) {
+    RelocationPlan plan;
+    plan.symbolIdsPerInstSegment.resize(relocations.size());
+    for (size_t segId = 0; segId < relocations.size(); segId++) {
+        plan.symbolIdsPerInstSegment[segId].reserve(relocations[segId].size());
+        for (const auto &relocation : relocations[segId]) {
+            plan.addRelocation(static_cast<uint32_t>(segId), plan.internSymbol(relocation.symbolName));
+        }
+    }
+    return plan;
+}
+
 LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo, const SegmentInfo &exportedFunctionsSegInfo,
                            const SegmentInfo &globalStringsSegInfo, GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
                            const PatchableSegments &instructionsSegments, UnresolvedExternals &outUnresolvedExternals, Device *pDevice, const void *constantsInitData,
@@ -384,53 +448,129 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
         return;
     }
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    auto segIt = instructionsSegments.begin();
-    uint32_t segId = 0u;
-    for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
-         relocsIt != relocsEnd; ++relocsIt, ++segIt, ++segId) {
-        auto &thisSegmentRelocs = *relocsIt;
-        const PatchableSegment &instSeg = *segIt;
-        for (const auto &relocation : thisSegmentRelocs) {
-            UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
-            bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
-            DEBUG_BREAK_IF(invalidOffset);
-
-            auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
-                continue;
-            };
-            if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                if (pImplicitArgsRelocationAddresses.find(segId) == pImplicitArgsRelocationAddresses.end()) {
-                    pImplicitArgsRelocationAddresses.insert({segId, {}});
+    LinkerInput::RelocationPlan rebuiltPlan;
+    const auto *relocationPlan = &data.getRelocationPlan();
+    if (false == relocationPlan->isValidFor(data.getRelocationsInInstructionSegments())) {
+        rebuiltPlan = LinkerInput::RelocationPlan::build(data.getRelocationsInInstructionSegments());
+        relocationPlan = &rebuiltPlan;
+    }
+    const auto &plan = *relocationPlan;
+
+    // resolve every distinct symbol once, so that patching does not hash symbol names per relocation
+    std::vector<ResolvedRelocationSymbol> resolvedSymbols(plan.symbolNames.size());
+    for (size_t symbolId = 0; symbolId < plan.symbolNames.size(); symbolId++) {
+        const auto &symbolName = plan.symbolNames[symbolId];
+        auto &resolvedSymbol = resolvedSymbols[symbolId];
+        resolvedSymbol.isImplicitArgs = (symbolName == implicitArgsRelocationSymbolName);
+        auto symbolIt = relocatedSymbols.find(symbolName);
+        if (symbolIt != relocatedSymbols.end()) {
+            resolvedSymbol.symbol = &symbolIt->second;
+            continue;
+        }
+        auto localSymbolIt = localRelocatedSymbols.find(symbolName);
+        if (localSymbolIt != localRelocatedSymbols.end()) {
+            resolvedSymbol.localSymbol = &localSymbolIt->second;
+        }
+    }
+
+    const auto segmentsCount = static_cast<uint32_t>(data.getRelocationsInInstructionSegments().size());
+    size_t threadsCount = 1u;
+    if (DebugManager.flags.LinkerPatchingThreads.get() >= 0) {
+        threadsCount = static_cast<size_t>(DebugManager.flags.LinkerPatchingThreads.get());
+        if (threadsCount == 0u) {
+            threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        threadsCount = std::min(threadsCount, static_cast<size_t>(segmentsCount));
+    }
+
+    if (threadsCount <= 1u) {
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            StackVec<uint32_t *, 2> implicitArgsRelocationAddresses;
+            patchInstructionsSegment(segId, instructionsSegments[segId], plan, resolvedSymbols, kernelDescriptors, outUnresolvedExternals, implicitArgsRelocationAddresses);
+            if (false == implicitArgsRelocationAddresses.empty()) {
+                auto &segmentImplicitArgsRelocationAddresses = pImplicitArgsRelocationAddresses[segId];
+                for (auto relocationAddress : implicitArgsRelocationAddresses) {
+                    segmentImplicitArgsRelocationAddresses.push_back(relocationAddress);
                 }
-                pImplicitArgsRelocationAddresses[segId].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-                continue;
             }
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-            if (symbolIt == relocatedSymbols.end()) {
-                auto localSymbolIt = localRelocatedSymbols.find(relocation.symbolName);
-                if (localRelocatedSymbols.end() != localSymbolIt) {
-                    if (localSymbolIt->first == kernelDescriptors[segId]->kernelMetadata.kernelName) {
-                        uint64_t patchValue = localSymbolIt->second.gpuAddress + relocation.addend;
-                        patchAddress(relocAddress, patchValue, relocation);
-                        continue;
-                    }
-                } else if (relocation.symbolName.empty()) {
-                    uint64_t patchValue = 0;
+        }
+        return;
+    }
+
+    // segments are patched independently, results are merged in segment order to match serial patching
+    struct SegmentPatchResult {
+        UnresolvedExternals unresolvedExternals;
+        StackVec<uint32_t *, 2> implicitArgsRelocationAddresses;
+    };
+    std::vector<SegmentPatchResult> results(segmentsCount);
+    std::atomic<uint32_t> nextSegment{0u};
+    auto patchSegments = [&]() {
+        for (auto segId = nextSegment++; segId < segmentsCount; segId = nextSegment++) {
+            patchInstructionsSegment(segId, instructionsSegments[segId], plan, resolvedSymbols, kernelDescriptors, results[segId].unresolvedExternals, results[segId].implicitArgsRelocationAddresses);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadsCount; i++) {
+        workers.emplace_back(patchSegments);
+    }
+    patchSegments();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        auto &result = results[segId];
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), result.unresolvedExternals.begin(), result.unresolvedExternals.end());
+        if (false == result.implicitArgsRelocationAddresses.empty()) {
+            auto &segmentImplicitArgsRelocationAddresses = pImplicitArgsRelocationAddresses[segId];
+            for (auto relocationAddress : result.implicitArgsRelocationAddresses) {
+                segmentImplicitArgsRelocationAddresses.push_back(relocationAddress);
+            }
+        }
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const LinkerInput::RelocationPlan &plan, const std::vector<ResolvedRelocationSymbol> &resolvedSymbols,
+                                      const KernelDescriptorsT &kernelDescriptors, UnresolvedExternals &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses) {
+    const auto &thisSegmentRelocs = data.getRelocationsInInstructionSegments()[segId];
+    const auto &thisSegmentSymbolIds = plan.symbolIdsPerInstSegment[segId];
+    for (size_t relocId = 0; relocId < thisSegmentRelocs.size(); relocId++) {
+        const auto &relocation = thisSegmentRelocs[relocId];
+        UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
+        bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
+        DEBUG_BREAK_IF(invalidOffset);
+
+        auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
+            *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
+            continue;
+        };
+        const auto &resolvedSymbol = resolvedSymbols[thisSegmentSymbolIds[relocId]];
+        if (resolvedSymbol.isImplicitArgs) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+            continue;
+        }
+        if (nullptr == resolvedSymbol.symbol) {
+            if (nullptr != resolvedSymbol.localSymbol) {
+                if (plan.symbolNames[thisSegmentSymbolIds[relocId]] == kernelDescriptors[segId]->kernelMetadata.kernelName) {
+                    uint64_t patchValue = resolvedSymbol.localSymbol->gpuAddress + relocation.addend;
                     patchAddress(relocAddress, patchValue, relocation);
                     continue;
                 }
-            }
-            bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
-            if (invalidOffset || unresolvedExternal) {
-                uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            } else if (relocation.symbolName.empty()) {
+                uint64_t patchValue = 0;
+                patchAddress(relocAddress, patchValue, relocation);
                 continue;
             }
-            uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-            patchAddress(relocAddress, patchValue, relocation);
         }
+        bool unresolvedExternal = (nullptr == resolvedSymbol.symbol);
+        if (invalidOffset || unresolvedExternal) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            continue;
+        }
+        uint64_t patchValue = resolvedSymbol.symbol->gpuAddress + relocation.addend;
+        patchAddress(relocAddress, patchValue, relocation);
     }
 }
 
@@ -111,6 +111,21 @@ struct LinkerInput {
     using LocalSymbolMap = std::unordered_map<std::string, LocalFuncSymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
 
+    // Symbol names of instruction segment relocations interned into dense ids.
+    // Built while relocations are decoded, so linking resolves each distinct symbol once instead of once per relocation.
+    struct RelocationPlan {
+        static constexpr uint32_t invalidSymbolId = std::numeric_limits<uint32_t>::max();
+
+        uint32_t internSymbol(const std::string &symbolName);
+        void addRelocation(uint32_t instructionsSegmentId, uint32_t symbolId);
+        bool isValidFor(const RelocationsPerInstSegment &relocations) const;
+        static RelocationPlan build(const RelocationsPerInstSegment &relocations);
+
+        std::vector<std::string> symbolNames;
+        std::vector<std::vector<uint32_t>> symbolIdsPerInstSegment;
+        std::unordered_map<std::string, uint32_t> symbolIds;
+    };
+
     virtual ~LinkerInput() = default;
 
     static SegmentType getSegmentForSection(ConstStringRef name);
@@ -121,6 +136,7 @@ struct LinkerInput {
     void addDataRelocationInfo(const RelocationInfo &relocationInfo);
 
     void addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId);
+    void addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId, uint32_t symbolId);
 
     template <Elf::ELF_IDENTIFIER_CLASS numBits>
     void decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, const SectionNameToSegmentIdMap &nameToSegmentId);
@@ -157,6 +173,10 @@ struct LinkerInput {
         return dataRelocations;
     }
 
+    const RelocationPlan &getRelocationPlan() const {
+        return relocationPlan;
+    }
+
     void setPointerSize(Traits::PointerSize pointerSize) {
         traits.pointerSize = pointerSize;
     }
@@ -186,6 +206,8 @@ struct LinkerInput {
     std::vector<ExternalFunctionUsageKernel> kernelDependencies;
     std::vector<ExternalFunctionUsageExtFunc> extFunDependencies;
     bool valid = true;
+
+    RelocationPlan relocationPlan;
 };
 
 struct Linker {
@@ -217,6 +239,12 @@ struct Linker {
         uintptr_t gpuAddress = std::numeric_limits<uintptr_t>::max();
     };
 
+    struct ResolvedRelocationSymbol {
+        const RelocatedSymbol<SymbolInfo> *symbol = nullptr;
+        const RelocatedSymbol<LocalFuncSymbolInfo> *localSymbol = nullptr;
+        bool isImplicitArgs = false;
+    };
+
     using RelocatedSymbolsMap = std::unordered_map<std::string, RelocatedSymbol<SymbolInfo>>;
     using LocalsRelocatedSymbolsMap = std::unordered_map<std::string, RelocatedSymbol<LocalFuncSymbolInfo>>;
     using PatchableSegments = std::vector<PatchableSegment>;
@@ -252,6 +280,8 @@ struct Linker {
     bool processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const LinkerInput::RelocationPlan &plan, const std::vector<ResolvedRelocationSymbol> &resolvedSymbols,
+                                  const KernelDescriptorsT &kernelDescriptors, UnresolvedExternals &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses);
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
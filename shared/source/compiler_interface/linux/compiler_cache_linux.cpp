@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::string CompilerCache::getTemporaryFilePath(const std::string &filePath) {
+    static std::atomic<uint32_t> tmpFileCounter{0u};
+    return filePath + "." + std::to_string(getpid()) + "_" + std::to_string(tmpFileCounter++) + ".tmp";
+}
+
+bool CompilerCache::renameCachedFile(const std::string &oldFilePath, const std::string &newFilePath) {
+    return 0 == std::rename(oldFilePath.c_str(), newFilePath.c_str());
+}
+
+size_t CompilerCache::getCachedFileSize(const std::string &filePath) {
+    struct stat fileStat = {};
+    if (0 != stat(filePath.c_str(), &fileStat)) {
+        return 0u;
+    }
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void CompilerCache::updateLastAccessTime(const std::string &filePath) {
+    // atime is unreliable with relatime/noatime mounts, so LRU order is kept in mtime
+    utimensat(AT_FDCWD, filePath.c_str(), nullptr, 0);
+}
+
+std::vector<CompilerCache::CachedFileInfo> CompilerCache::getCachedFiles() {
+    std::vector<CachedFileInfo> files;
+
+    DIR *dir = opendir(config.cacheDir.c_str());
+    if (dir == nullptr) {
+        return files;
+    }
+
+    const auto &extension = config.cacheFileExtension;
+    const std::string temporaryExtension = ".tmp";
+    auto endsWith = [](const std::string &fileName, const std::string &suffix) {
+        return fileName.size() > suffix.size() && 0 == fileName.compare(fileName.size() - suffix.size(), suffix.size(), suffix);
+    };
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        std::string fileName = entry->d_name;
+        if (fileName[0] == '.') {
+            continue;
+        }
+        // temporary files are named <hash><extension>.<pid>_<counter>.tmp, see getTemporaryFilePath
+        const bool isTemporary = endsWith(fileName, temporaryExtension) && std::string::npos != fileName.find(extension + ".");
+        if (!isTemporary && !endsWith(fileName, extension)) {
+            continue;
+        }
+
+        CachedFileInfo fileInfo;
+        fileInfo.path = config.cacheDir + "/" + fileName;
+        fileInfo.isTemporary = isTemporary;
+
+        struct stat fileStat = {};
+        if (0 != stat(fileInfo.path.c_str(), &fileStat)) {
+            continue;
+        }
+        fileInfo.size = static_cast<size_t>(fileStat.st_size);
+        fileInfo.lastAccessTime = fileStat.st_mtime;
+        files.push_back(std::move(fileInfo));
+    }
+
+    closedir(dir);
+    return files;
+}
+
+} // namespace NEO
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+#include <atomic>
+#include <cstdio>
+#include <sys/utime.h>
+#include <utility>
+
+namespace NEO {
+
+std::string CompilerCache::getTemporaryFilePath(const std::string &filePath) {
+    static std::atomic<uint32_t> tmpFileCounter{0u};
+    return filePath + "." + std::to_string(GetCurrentProcessId()) + "_" + std::to_string(tmpFileCounter++) + ".tmp";
+}
+
+bool CompilerCache::renameCachedFile(const std::string &oldFilePath, const std::string &newFilePath) {
+    return 0 != MoveFileExA(oldFilePath.c_str(), newFilePath.c_str(), MOVEFILE_REPLACE_EXISTING);
+}
+
+size_t CompilerCache::getCachedFileSize(const std::string &filePath) {
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributes;
+    if (0 == GetFileAttributesExA(filePath.c_str(), GetFileExInfoStandard, &fileAttributes)) {
+        return 0u;
+    }
+    return static_cast<size_t>((static_cast<uint64_t>(fileAttributes.nFileSizeHigh) << 32) | fileAttributes.nFileSizeLow);
+}
+
+void CompilerCache::updateLastAccessTime(const std::string &filePath) {
+    _utime(filePath.c_str(), nullptr);
+}
+
+std::vector<CompilerCache::CachedFileInfo> CompilerCache::getCachedFiles() {
+    std::vector<CachedFileInfo> files;
+
+    // temporary files are named <hash><extension>.<pid>_<counter>.tmp, see getTemporaryFilePath
+    const std::pair<std::string, bool> patterns[] = {{config.cacheDir + "\\*" + config.cacheFileExtension, false},
+                                                     {config.cacheDir + "\\*" + config.cacheFileExtension + ".*.tmp", true}};
+    for (const auto &[pattern, isTemporary] : patterns) {
+        WIN32_FIND_DATAA ffd;
+        HANDLE hFind = FindFirstFileA(pattern.c_str(), &ffd);
+        if (INVALID_HANDLE_VALUE == hFind) {
+            continue;
+        }
+
+        do {
+            if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                continue;
+            }
+            CachedFileInfo fileInfo;
+            fileInfo.path = config.cacheDir + "\\" + ffd.cFileName;
+            fileInfo.isTemporary = isTemporary;
+            fileInfo.size = static_cast<size_t>((static_cast<uint64_t>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow);
+            ULARGE_INTEGER lastWriteTime;
+            lastWriteTime.LowPart = ffd.ftLastWriteTime.dwLowDateTime;
+            lastWriteTime.HighPart = ffd.ftLastWriteTime.dwHighDateTime;
+            // FILETIME counts 100ns intervals since 1601, convert to seconds since epoch
+            fileInfo.lastAccessTime = static_cast<time_t>(lastWriteTime.QuadPart / 10000000ULL - 11644473600ULL);
+            files.push_back(std::move(fileInfo));
+        } while (FindNextFileA(hFind, &ffd) != 0);
+
+        FindClose(hFind);
+    }
+    return files;
+}
+
+} // namespace NEO
@@ -150,6 +150,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceMultiGpuAtomicsInComputeMode, -1, "-1: defa
 DECLARE_DEBUG_VARIABLE(int32_t, ForceMultiGpuAtomics, -1, "-1: default - 0 for multiOsContext capable, 0: program value 0 in MultiGpuAtomics controls 1: program value 1 in MultiGpuAtomics controls")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceBufferCompressionFormat, -1, "-1: default, >0: Format value")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHwGenerationLocalIds, -1, "-1: default, 0: disable, 1: enable : Enables generation of local ids on HW")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheSize, -1, "-1: default - 16, >0: number of work group sizes for which generated local ids are cached per kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, ZebinKernelDecodeThreads, -1, "-1: default - decode zebin kernels serially, 0: use all hardware threads, >0: number of threads decoding zebin kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, LinkerPatchingThreads, -1, "-1: default - patch instruction segments serially, 0: use all hardware threads, >0: number of threads patching instruction segments")
 DECLARE_DEBUG_VARIABLE(int32_t, WalkerPartitionPreferHighestDimension, -1, "-1: default, 0: prefer biggest dimension, 1: prefer Z over Y over X if they divide partition count evenly")
 DECLARE_DEBUG_VARIABLE(int32_t, SetMinimalPartitionSize, -1, "-1 default value set to 512 workgroups, 0 - disabled, >0 - minimal partition size in workgroups (should be power of 2)")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideBlitterTargetMemory, -1, "-1:default 0: overwrites to System 1: overwrites to Local")
@@ -228,6 +231,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, NumberOfRegularContextsPerEngine, -1, "-1: defau
 DECLARE_DEBUG_VARIABLE(int32_t, EnableMultipleRegularContextForBcs, -1, "-1: default, 0: disabled, 1: Use NumberOfRegularContextsPerEngine to create multiple Regular contexts on the same engine")
 DECLARE_DEBUG_VARIABLE(int32_t, AppendAubStreamContextFlags, -1, "-1: default, >0: Append flags passed during HardwareContext creation.")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideEventSynchronizeTimeout, -1, "-1: default - user provided timeout value,  >0: timeout in nanoseconds")
+DECLARE_DEBUG_VARIABLE(int64_t, ReusableAllocationsMaxTotalSize, -1, "-1: default - unlimited, >=0: total size in bytes of allocations kept for reuse by a command stream receiver, least recently stored completed allocations above the limit are released")
+DECLARE_DEBUG_VARIABLE(int64_t, ReusableAllocationsMaxAge, -1, "-1: default - unlimited, >=0: completed allocations kept for reuse are released when not reused for more than given number of task count increments")
 
 /*LOGGING FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
@@ -331,6 +336,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableMonitorFence, -1, "Disabl
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmissionController, -1, "Enable direct submission terminating after given timeout, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeout, -1, "Set direct submission controller timeout, -1: default 5000 us, >=0: timeout in us")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerDivisor, -1, "Set direct submission controller timeout divider, -1: default 1, >0: divider value")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptivePolicy, -1, "Set direct submission controller idle policy, -1: default, 0: stop after first idle timeout, 1: low latency, keep ring running for predicted gap between submissions, 2: low power, short idle prediction")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionControllerPrintStatistics, false, "Print direct submission controller stop and restart counters on destruction")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionForceLocalMemoryStorageMode, -1, "Force local memory storage for command/ring/semaphore buffer, -1: default - for all engines, 0: disabled, 1: for multiOsContextCapable engine, 2: for all engines")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRingSwitchTagUpdateWa, -1, "-1: default, 0 - disable, 1 - enable. If enabled, completionFences wont be updated if ring is not running.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionReadBackCommandBuffer, -1, "-1: default - disabled, 0 - disable, 1 - enable. If enabled, read first dword of cmd buffer after handling residency.")
@@ -349,6 +356,8 @@ DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address
 DECLARE_DEBUG_VARIABLE(bool, EnableL0ReadLUIDExtension, false, "Enables Support for L0 Extension for reading the LUID from WDDM.")
 DECLARE_DEBUG_VARIABLE(bool, EnableL0EuCount, false, "Enables Support for L0 Extension for querying total nubmer of EUs.")
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmSharedMigrationChunkSize, -1, "-1: default - migrate whole shared allocation on CPU page fault, >0: migrate only chunks of given size (rounded up to power of two, at least page size) touched by CPU")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmSharedMigrationPrefetchChunks, -1, "-1: default - 1, >=0: number of chunks following faulting chunk migrated to CPU together with it, used with UsmSharedMigrationChunkSize")
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
@@ -372,6 +381,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerThreadsCount, -1, "Number of threads closing gem objects asynchronously, -1:default(1), >0:threads count")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
@@ -408,6 +418,11 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins i
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitYieldThresholdInMicroSeconds, -1, "-1: use default, >=0: time since wait started after which wait loop yields thread")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitBlockThresholdInMicroSeconds, -1, "-1: use default(0), 0: never block, >0: time since wait started after which wait loop blocks on umwait or sleep")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitBlockTimeInMicroSeconds, -1, "-1: use default, >=0: sleep time of blocking wait when umwait is not used")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitpkgCounterValue, -1, "-1: use default, >=0: TSC ticks after which umwait in blocking wait times out")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWaitpkg, -1, "-1: use default, 0: disable, 1: enable - use umonitor/umwait in blocking wait when supported by CPU")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (disabled), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
@@ -455,11 +470,18 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionCount, 0, "Experim
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionType, -1, "Experimental implementation: Set COMPUTE_WALKER Partition Type. Valid values for types from 1 to 3")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0, "Align local memory allocations to a given value. Works only with allocations at least as big as the value.  0: no effect, 2097152: 2 megabytes, 1073741824: 1 gigabyte")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable allocation cache.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host USM allocation cache.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableSharedAllocationCache, -1, "Experimentally enable shared USM allocation cache. Applies to shared allocations without separate cpu storage.")
+DECLARE_DEBUG_VARIABLE(int64_t, ExperimentalAllocationCacheMaxSize, -1, "Limit in bytes of memory held by each USM allocation cache, oldest allocations are released first. -1: default (no limit)")
+DECLARE_DEBUG_VARIABLE(int64_t, ExperimentalAllocationCacheMaxAge, -1, "Time in milliseconds after which allocation held by USM allocation cache is released. -1: default (no limit)")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default treshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default treshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalBufferPoolSizeClasses, -1, "-1: default (disabled), 0: disabled, 1: enabled - pool allocator also serves clCreateBuffer up to 64KB and 256KB from 1MB and 2MB pools")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (disabled), 0: disabled, >0: size in MB of per context pool sub-allocating zeMemAllocHost allocations up to 1MB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (disabled), 0: disabled, >0: size in MB of per context and root device pool sub-allocating zeMemAllocDevice allocations up to 1MB")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -801,8 +801,8 @@ struct InlineSamplerBaseT {
 
 namespace GlobalHostAccessTable {
 struct globalHostAccessTableT {
-    std::string deviceName;
-    std::string hostName;
+    ConstStringRef deviceName;
+    ConstStringRef hostName;
 };
 } // namespace GlobalHostAccessTable
 
@@ -816,12 +816,12 @@ namespace Miscellaneous {
 using ArgIndexT = int32_t;
 struct KernelArgMiscInfoT {
     ArgIndexT index = -1;
-    std::string kernelName;
-    std::string argName;
-    std::string accessQualifier;
-    std::string addressQualifier;
-    std::string typeName;
-    std::string typeQualifiers;
+    ConstStringRef kernelName;
+    ConstStringRef argName;
+    ConstStringRef accessQualifier;
+    ConstStringRef addressQualifier;
+    ConstStringRef typeName;
+    ConstStringRef typeQualifiers;
 };
 } // namespace Miscellaneous
 
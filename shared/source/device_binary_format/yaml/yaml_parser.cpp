@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,66 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include "shared/source/helpers/basic_math.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define YAML_SCAN_SSE2 1
+#endif
+
 namespace NEO {
 
 namespace Yaml {
 
+const char *findCharacter(const char *pos, const char *end, char c) {
+    if (pos >= end) {
+        return end;
+    }
+    auto found = reinterpret_cast<const char *>(memchr(pos, c, end - pos));
+    return (nullptr != found) ? found : end;
+}
+
+const char *skipCharacter(const char *pos, const char *end, char c) {
+#if YAML_SCAN_SSE2
+    const auto pattern = _mm_set1_epi8(c);
+    while (end - pos >= 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+        auto mismatches = static_cast<uint32_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern))) & 0xffffU;
+        if (0U != mismatches) {
+            return pos + Math::getMinLsbSet(mismatches);
+        }
+        pos += 16;
+    }
+#endif
+    while ((pos < end) && (c == *pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+size_t countCharacter(const char *pos, const char *end, char c) {
+    size_t count = 0U;
+#if YAML_SCAN_SSE2
+    const auto pattern = _mm_set1_epi8(c);
+    while (end - pos >= 16) {
+        // per-byte counters, flushed before they can overflow
+        auto counters = _mm_setzero_si128();
+        for (int i = 0; (i < 255) && (end - pos >= 16); ++i, pos += 16) {
+            auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+            counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(chunk, pattern));
+        }
+        auto sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+        count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+    }
+#endif
+    for (; pos < end; ++pos) {
+        count += (c == *pos) ? 1U : 0U;
+    }
+    return count;
+}
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason) {
     auto ret = "NEO::Yaml : Could not parse line : [" + std::to_string(lineNumber) + "] : [" + ConstStringRef(lineBeg, parsePos - lineBeg + 1).str() + "] <-- parser position on error";
     if (nullptr != reason) {
@@ -154,13 +210,19 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
+    auto estimatedNumLines = countCharacter(text.begin(), text.end(), '\n') + 1;
+    outLines.reserve(outLines.size() + estimatedNumLines);
+    outTokens.reserve(outTokens.size() + estimatedNumLines * estimatedTokensPerLine);
+
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = skipCharacter(context.pos, context.end, ' ');
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +237,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = findCharacter(context.pos + 1, context.end, '\n');
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
             }
@@ -353,6 +409,13 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
     size_t lastUsedLine = 0u;
+    // root + one node per line + extra nodes for list entries holding a dictionary and for inline collection elements
+    size_t estimatedNumNodes = 1U + lines.size();
+    for (const auto &line : lines) {
+        estimatedNumNodes += (Line::LineType::ListEntry == line.lineType) ? 1U : 0U;
+        estimatedNumNodes += line.traits.hasInlineDataMarkers ? (line.last - line.first) / 2 : 0U;
+    }
+    outNodes.reserve(estimatedNumNodes);
     outNodes.push_back(Node());
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
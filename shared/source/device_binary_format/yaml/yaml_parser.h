@@ -150,6 +150,11 @@ constexpr const char *consumeStringLiteral(ConstStringRef wholeText, const char
     return it + 1;
 }
 
+// Vectorized scanning helpers, all return/count within [pos, end)
+const char *findCharacter(const char *pos, const char *end, char c);
+const char *skipCharacter(const char *pos, const char *end, char c);
+size_t countCharacter(const char *pos, const char *end, char c);
+
 using TokenId = uint32_t;
 
 constexpr TokenId invalidTokenId = std::numeric_limits<TokenId>::max();
@@ -220,7 +225,7 @@ constexpr bool operator!=(char matcher, Token token) {
 
 constexpr bool isVectorDataType(const Token &token) {
     auto tokenString = ConstStringRef(token.pos, token.len);
-    constexpr std::array<const char *, 7> vectorAttributesNames = {
+    constexpr std::array<ConstStringRef, 7> vectorAttributesNames = {
         "kernels",
         "functions",
         "global_host_access_table",
@@ -284,6 +289,9 @@ inline bool reserveBasedOnEstimates(T &container, It beg, It end, It pos) {
 using TokensCache = StackVec<Token, 2048>;
 using LinesCache = StackVec<Line, 512>;
 
+// Typical zeInfo line is "- key: value\n"
+constexpr size_t estimatedTokensPerLine = 5U;
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason = nullptr);
 
 bool isValidInlineCollectionFormat(const char *context, const char *contextEnd);
@@ -704,6 +712,16 @@ inline bool YamlParser::readValueChecked<std::string>(const Node &node, std::str
     outValue.assign(token.pos, token.len);
     return true;
 }
+
+template <>
+inline bool YamlParser::readValueChecked<ConstStringRef>(const Node &node, ConstStringRef &outValue) const {
+    const auto &token = tokens[node.value];
+    if (Token::Type::LiteralString != token.traits.type) {
+        return false;
+    }
+    outValue = token.cstrref();
+    return true;
+}
 } // namespace Yaml
 
 } // namespace NEO
@@ -25,6 +25,9 @@
 
 #include "platforms.h"
 
+#include <atomic>
+#include <thread>
+
 namespace NEO {
 
 void setKernelMiscInfoPosition(ConstStringRef metadata, NEO::ProgramInfo &dst) {
@@ -602,7 +605,7 @@ DecodeError readKernelMiscArgumentInfos(const NEO::Yaml::YamlParser &parser, con
             } else if (key == Elf::ZebinKernelMetadata::Tags::KernelMiscInfo::ArgsInfo::index) {
                 validArgInfo &= parser.readValueChecked(singleArgInfoMember, metadataExtended.index);
             } else if (key == Elf::ZebinKernelMetadata::Tags::KernelMiscInfo::ArgsInfo::typeName) {
-                metadataExtended.typeName = parser.readValueNoQuotes(singleArgInfoMember).str();
+                metadataExtended.typeName = parser.readValueNoQuotes(singleArgInfoMember);
                 validArgInfo &= (false == metadataExtended.typeName.empty());
             } else if (key == Elf::ZebinKernelMetadata::Tags::KernelMiscInfo::ArgsInfo::typeQualifiers) {
                 validArgInfo &= readZeInfoValueChecked(parser, singleArgInfoMember, metadataExtended.typeQualifiers, Elf::ZebinKernelMetadata::Tags::kernelMiscInfo, outErrReason);
@@ -619,9 +622,9 @@ DecodeError readKernelMiscArgumentInfos(const NEO::Yaml::YamlParser &parser, con
 }
 
 void populateKernelMiscInfo(KernelDescriptor &dst, KernelMiscArgInfos &kernelMiscArgInfosVec, std::string &outErrReason, std::string &outWarning) {
-    auto populateIfNotEmpty = [](std::string &src, std::string &dst, ConstStringRef context, std::string &warnings) {
+    auto populateIfNotEmpty = [](ConstStringRef src, std::string &dst, ConstStringRef context, std::string &warnings) {
         if (false == src.empty()) {
-            dst = std::move(src);
+            dst.assign(src.data(), src.length());
         } else {
             warnings.append("DeviceBinaryFormat::Zebin : KernelMiscInfo : ArgInfo member \"" + context.str() + "\" missing. Ignoring.\n");
         }
@@ -663,11 +666,11 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
 
     auto kernelMiscInfoSectionNode = parser.createChildrenRange(*parser.getRoot());
     auto validMetadata = true;
-    using KernelArgsMiscInfoVec = std::vector<std::pair<std::string, KernelMiscArgInfos>>;
+    using KernelArgsMiscInfoVec = std::vector<std::pair<ConstStringRef, KernelMiscArgInfos>>;
     KernelArgsMiscInfoVec kernelArgsMiscInfoVec;
 
     for (const auto &kernelMiscInfoNode : parser.createChildrenRange(*kernelMiscInfoSectionNode.begin())) {
-        std::string kernelName{};
+        ConstStringRef kernelName;
         KernelMiscArgInfos miscArgInfosVec;
         for (const auto &kernelMiscInfoNodeMetadata : parser.createChildrenRange(kernelMiscInfoNode)) {
             auto key = parser.readKey(kernelMiscInfoNodeMetadata);
@@ -683,7 +686,7 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
             outErrReason.append("DeviceBinaryFormat::Zebin : Error : Missing kernel name in " + Elf::ZebinKernelMetadata::Tags::kernelMiscInfo.str() + " section.\n");
             validMetadata = false;
         }
-        kernelArgsMiscInfoVec.emplace_back(std::make_pair(std::move(kernelName), miscArgInfosVec));
+        kernelArgsMiscInfoVec.emplace_back(std::make_pair(kernelName, std::move(miscArgInfosVec)));
     }
     if (false == validMetadata) {
         return DecodeError::InvalidBinary;
@@ -696,7 +699,7 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
             }
         }
         if (nullptr == kernelInfo) {
-            outErrReason.append("DeviceBinaryFormat::Zebin : Error : Cannot find kernel info for kernel " + kName + ".\n");
+            outErrReason.append("DeviceBinaryFormat::Zebin : Error : Cannot find kernel info for kernel " + kName.str() + ".\n");
             return DecodeError::InvalidBinary;
         }
         populateKernelMiscInfo(kernelInfo->kernelDescriptor, miscInfos, outErrReason, outWarning);
@@ -910,7 +913,7 @@ DecodeError decodeZeInfoGlobalHostAccessTable(ProgramInfo &dst, Yaml::YamlParser
         }
         dst.globalsDeviceToHostNameMap.reserve(globalHostAccessMapping.size());
         for (auto it = globalHostAccessMapping.begin(); it != globalHostAccessMapping.end(); it++) {
-            dst.globalsDeviceToHostNameMap[it->deviceName] = it->hostName;
+            dst.globalsDeviceToHostNameMap[it->deviceName.str()] = it->hostName.str();
         }
     }
     return DecodeError::Success;
@@ -930,6 +933,14 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
 
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
+    if (DebugManager.flags.ZebinKernelDecodeThreads.get() >= 0) {
+        auto threadsCount = static_cast<size_t>(DebugManager.flags.ZebinKernelDecodeThreads.get());
+        if (threadsCount == 0u) {
+            threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        return decodeZeInfoKernelsInParallel(dst, parser, zeInfoSections, threadsCount, outErrReason, outWarning);
+    }
+
     for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
         auto kernelInfo = std::make_unique<KernelInfo>();
         auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning);
@@ -942,6 +953,53 @@ DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, cons
     return DecodeError::Success;
 }
 
+DecodeError decodeZeInfoKernelsInParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, size_t threadsCount, std::string &outErrReason, std::string &outWarning) {
+    struct KernelDecodeResult {
+        const Yaml::Node *kernelNd = nullptr;
+        std::unique_ptr<KernelInfo> kernelInfo;
+        DecodeError decodeError = DecodeError::Success;
+        std::string errReason;
+        std::string warning;
+    };
+
+    std::vector<KernelDecodeResult> results;
+    results.reserve(zeInfoSections.kernels[0]->numChildren);
+    for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+        results.emplace_back();
+        results.rbegin()->kernelNd = &kernelNd;
+    }
+
+    std::atomic<size_t> nextKernel{0u};
+    auto decodeKernels = [&]() {
+        for (auto kernelIndex = nextKernel++; kernelIndex < results.size(); kernelIndex = nextKernel++) {
+            auto &result = results[kernelIndex];
+            result.kernelInfo = std::make_unique<KernelInfo>();
+            result.decodeError = decodeZeInfoKernelEntry(result.kernelInfo->kernelDescriptor, parser, *result.kernelNd, dst.grfSize, dst.minScratchSpaceSize, result.errReason, result.warning);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(threadsCount, results.size());
+    for (size_t i = 1; i < workersCount; i++) {
+        workers.emplace_back(decodeKernels);
+    }
+    decodeKernels();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // merge in kernel order, so that messages and the reported error match serial decoding
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::Success != result.decodeError) {
+            outErrReason.append(result.errReason);
+            return result.decodeError;
+        }
+        dst.kernelInfos.push_back(result.kernelInfo.release());
+    }
+    return DecodeError::Success;
+}
+
 DecodeError decodeZeInfoKernelEntry(NEO::KernelDescriptor &dst, NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning) {
     ZeInfoKernelSections zeInfokernelSections;
     extractZeInfoKernelSections(yamlParser, kernelNd, zeInfokernelSections, NEO::Elf::SectionsNamesZebin::zeInfo, outWarning);
@@ -128,6 +128,7 @@ DecodeError decodeZeInfoVersion(Yaml::YamlParser &parser, const ZeInfoSections &
 DecodeError decodeZeInfoGlobalHostAccessTable(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeZeInfoKernelsInParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, size_t threadsCount, std::string &outErrReason, std::string &outWarning);
 
 DecodeError decodeZeInfoKernelEntry(KernelDescriptor &dst, Yaml::YamlParser &yamlParser, const Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning);
 
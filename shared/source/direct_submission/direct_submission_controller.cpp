@@ -12,6 +12,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -24,6 +25,10 @@ DirectSubmissionController::DirectSubmissionController() {
     if (DebugManager.flags.DirectSubmissionControllerDivisor.get() != -1) {
         timeoutDivisor = DebugManager.flags.DirectSubmissionControllerDivisor.get();
     }
+    if (DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.get() != -1) {
+        policy = static_cast<DirectSubmissionControllerPolicy>(DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.get());
+        policyParameters = getPolicyParameters(policy);
+    }
 
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 };
@@ -34,6 +39,25 @@ DirectSubmissionController::~DirectSubmissionController() {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
     }
+    PRINT_DEBUG_STRING(DebugManager.flags.DirectSubmissionControllerPrintStatistics.get(), stdout,
+                       "Direct submission controller policy: %d, stops: %llu, restarts: %llu, premature stops: %llu\n",
+                       static_cast<int32_t>(policy), statistics.stops, statistics.restarts, statistics.prematureStops);
+}
+
+DirectSubmissionController::PolicyParameters DirectSubmissionController::getPolicyParameters(DirectSubmissionControllerPolicy policy) {
+    switch (policy) {
+    case DirectSubmissionControllerPolicy::LowLatency:
+        return {16u, 1u, 32u};
+    case DirectSubmissionControllerPolicy::LowPower:
+        return {6u, 1u, 4u};
+    default:
+        return {0u, 1u, 1u};
+    }
+}
+
+DirectSubmissionControllerStatistics DirectSubmissionController::getStatistics() {
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    return statistics;
 }
 
 void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
@@ -81,20 +105,48 @@ void DirectSubmissionController::checkNewSubmissions() {
 
         auto taskCount = csr->peekTaskCount();
         if (taskCount == state.taskCount) {
+            state.idleTicks++;
             if (state.isStopped) {
+                state.stoppedTicks++;
                 continue;
-            } else {
+            } else if (state.idleTicks >= getIdleTicksThreshold(state)) {
                 auto lock = csr->obtainUniqueOwnership();
                 csr->stopDirectSubmission();
                 state.isStopped = true;
+                state.stoppedTicks = 0u;
+                state.statistics.stops++;
+                this->statistics.stops++;
             }
         } else {
+            if (state.isStopped && state.statistics.stops > 0u) {
+                state.statistics.restarts++;
+                this->statistics.restarts++;
+                if (state.stoppedTicks == 0u) {
+                    state.statistics.prematureStops++;
+                    this->statistics.prematureStops++;
+                }
+            }
+            if (state.idleTicks > 0u) {
+                updateAverageGap(state);
+            }
+            state.idleTicks = 0u;
             state.isStopped = false;
             state.taskCount = taskCount;
         }
     }
 }
 
+void DirectSubmissionController::updateAverageGap(DirectSubmissionState &state) const {
+    uint32_t gapTicks = std::min(state.idleTicks, policyParameters.maxIdleTicks + 1u);
+    int64_t delta = static_cast<int64_t>(gapTicks << gapFractionBits) - static_cast<int64_t>(state.averageGapTicks);
+    state.averageGapTicks = static_cast<uint32_t>(static_cast<int64_t>(state.averageGapTicks) + delta / (1 << gapAveragingShift));
+}
+
+uint32_t DirectSubmissionController::getIdleTicksThreshold(const DirectSubmissionState &state) const {
+    uint32_t predictedIdleTicks = (state.averageGapTicks * policyParameters.gapMultiplierQuarters + (1u << (gapFractionBits + 2u)) - 1u) >> (gapFractionBits + 2u);
+    return std::clamp(predictedIdleTicks, policyParameters.minIdleTicks, policyParameters.maxIdleTicks);
+}
+
 void DirectSubmissionController::sleep() {
     std::this_thread::sleep_for(std::chrono::microseconds(this->timeout));
 }
@@ -21,8 +21,32 @@ class MemoryManager;
 class CommandStreamReceiver;
 class Thread;
 
+// Fixed policy stops the ring after the first controller timeout without new submissions.
+// Adaptive policies keep a moving average of idle periods between submissions of each CSR, counted in
+// controller timeouts, and stop the ring once current idle period exceeds a multiple of that prediction.
+enum class DirectSubmissionControllerPolicy : int32_t {
+    Fixed = 0,
+    LowLatency = 1,
+    LowPower = 2
+};
+
+struct DirectSubmissionControllerStatistics {
+    uint64_t stops = 0u;
+    uint64_t restarts = 0u;
+    uint64_t prematureStops = 0u;
+};
+
 class DirectSubmissionController {
   public:
+    static constexpr uint32_t gapFractionBits = 4u;
+    static constexpr uint32_t gapAveragingShift = 2u;
+
+    struct PolicyParameters {
+        uint32_t gapMultiplierQuarters;
+        uint32_t minIdleTicks;
+        uint32_t maxIdleTicks;
+    };
+
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -33,10 +57,18 @@ class DirectSubmissionController {
 
     static bool isSupported();
 
+    DirectSubmissionControllerPolicy getPolicy() const { return policy; }
+    DirectSubmissionControllerStatistics getStatistics();
+    static PolicyParameters getPolicyParameters(DirectSubmissionControllerPolicy policy);
+
   protected:
     struct DirectSubmissionState {
         bool isStopped = true;
         TaskCountType taskCount = 0u;
+        uint32_t idleTicks = 0u;
+        uint32_t stoppedTicks = 0u;
+        uint32_t averageGapTicks = 1u << gapFractionBits;
+        DirectSubmissionControllerStatistics statistics;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -44,6 +76,8 @@ class DirectSubmissionController {
     MOCKABLE_VIRTUAL void sleep();
 
     void adjustTimeout(CommandStreamReceiver *csr);
+    void updateAverageGap(DirectSubmissionState &state) const;
+    uint32_t getIdleTicksThreshold(const DirectSubmissionState &state) const;
 
     uint32_t maxCcsCount = 1u;
     std::array<uint32_t, DeviceBitfield().size()> ccsCount = {};
@@ -56,5 +90,9 @@ class DirectSubmissionController {
 
     int timeout = 5000;
     int timeoutDivisor = 1;
+
+    DirectSubmissionControllerPolicy policy = DirectSubmissionControllerPolicy::Fixed;
+    PolicyParameters policyParameters = getPolicyParameters(DirectSubmissionControllerPolicy::Fixed);
+    DirectSubmissionControllerStatistics statistics;
 };
 } // namespace NEO
\ No newline at end of file
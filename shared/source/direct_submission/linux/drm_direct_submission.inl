@@ -256,8 +256,11 @@ bool DrmDirectSubmission<GfxFamily, Dispatcher>::isCompletionFenceSupported() {
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::wait(TaskCountType taskCountToWait) {
     auto pollAddress = this->tagAddress;
+    auto waitStartTime = std::chrono::steady_clock::now();
+    int64_t timeSinceWaitStarted = 0;
     for (uint32_t i = 0; i < this->activeTiles; i++) {
-        while (!WaitUtils::waitFunction(pollAddress, taskCountToWait)) {
+        while (!WaitUtils::waitFunction(pollAddress, taskCountToWait, timeSinceWaitStarted)) {
+            timeSinceWaitStarted = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStartTime).count();
         }
         pollAddress = ptrOffset(pollAddress, this->postSyncOffset);
     }
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace NEO {
+
+struct HashValue128 {
+    uint64_t low = 0u;
+    uint64_t high = 0u;
+
+    bool operator==(const HashValue128 &other) const { return low == other.low && high == other.high; }
+    bool operator!=(const HashValue128 &other) const { return !(*this == other); }
+};
+
+// Streaming 128-bit hash in the spirit of XXH3.
+// Input is consumed in 32-byte stripes split across four 64-bit accumulators,
+// each 16-byte half of a stripe is processed with a single SSE2 (or NEON via sse2neon) step.
+// Scalar path produces bit-exact results and is kept as a reference.
+class Hash128 {
+  public:
+    static constexpr size_t stripeSize = 32u;
+    static constexpr size_t stripesPerBlock = 16u;
+    static constexpr size_t numAccumulators = 4u;
+
+    Hash128() {
+        reset();
+    }
+
+    void reset() {
+        acc[0] = prime32_3;
+        acc[1] = prime64_1;
+        acc[2] = prime64_2;
+        acc[3] = prime64_3;
+        totalLength = 0u;
+        bufferedSize = 0u;
+        stripesInBlock = 0u;
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr || size == 0u) {
+            return;
+        }
+        totalLength += size;
+
+        if (bufferedSize != 0u) {
+            auto toCopy = stripeSize - bufferedSize;
+            if (size < toCopy) {
+                memcpy(buffer + bufferedSize, buff, size);
+                bufferedSize += size;
+                return;
+            }
+            memcpy(buffer + bufferedSize, buff, toCopy);
+            consumeStripe(buffer);
+            buff += toCopy;
+            size -= toCopy;
+            bufferedSize = 0u;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(buff);
+            buff += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0u) {
+            memcpy(buffer, buff, size);
+            bufferedSize = size;
+        }
+    }
+
+    HashValue128 finish() const {
+        uint64_t finalAcc[numAccumulators] = {acc[0], acc[1], acc[2], acc[3]};
+        if (bufferedSize != 0u) {
+            char lastStripe[stripeSize] = {};
+            memcpy(lastStripe, buffer, bufferedSize);
+            accumulateStripe(finalAcc, lastStripe, useSimd);
+        }
+
+        HashValue128 result;
+        result.low = mul128Fold64(finalAcc[0] ^ secret[4], finalAcc[1] ^ secret[5]) +
+                     mul128Fold64(finalAcc[2] ^ secret[6], finalAcc[3] ^ secret[7]) +
+                     totalLength * prime64_1;
+        result.high = mul128Fold64(finalAcc[0] ^ secret[7], finalAcc[3] ^ secret[6]) +
+                      mul128Fold64(finalAcc[1] ^ secret[5], finalAcc[2] ^ secret[4]) -
+                      totalLength * prime64_2;
+        result.low = avalanche(result.low);
+        result.high = avalanche(result.high);
+        return result;
+    }
+
+    static HashValue128 hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+    static void accumulateStripe(uint64_t (&accumulators)[numAccumulators], const char *stripe, bool simd) {
+        if (simd) {
+            accumulateStripeSimd(accumulators, stripe);
+        } else {
+            accumulateStripeScalar(accumulators, stripe);
+        }
+    }
+
+    static void accumulateStripeScalar(uint64_t (&accumulators)[numAccumulators], const char *stripe) {
+        for (size_t i = 0; i < numAccumulators; i++) {
+            uint64_t data = readLE64(stripe + i * sizeof(uint64_t));
+            uint64_t dataKey = data ^ secret[i];
+            accumulators[i ^ 1] += data;
+            accumulators[i] += (dataKey & 0xFFFFFFFFu) * (dataKey >> 32);
+        }
+    }
+
+    static void accumulateStripeSimd(uint64_t (&accumulators)[numAccumulators], const char *stripe) {
+        for (size_t i = 0; i < numAccumulators; i += 2) {
+            __m128i accVec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&accumulators[i]));
+            __m128i dataVec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(stripe + i * sizeof(uint64_t)));
+            __m128i keyVec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&secret[i]));
+            __m128i dataKey = _mm_xor_si128(dataVec, keyVec);
+            __m128i dataKeyHigh = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+            __m128i product = _mm_mul_epu32(dataKey, dataKeyHigh);
+            __m128i dataSwapped = _mm_shuffle_epi32(dataVec, _MM_SHUFFLE(1, 0, 3, 2));
+            accVec = _mm_add_epi64(accVec, dataSwapped);
+            accVec = _mm_add_epi64(accVec, product);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&accumulators[i]), accVec);
+        }
+    }
+
+    static void scramble(uint64_t (&accumulators)[numAccumulators]) {
+        for (size_t i = 0; i < numAccumulators; i++) {
+            uint64_t value = accumulators[i];
+            value ^= value >> 47;
+            value ^= secret[numAccumulators + i];
+            value *= prime32_1;
+            accumulators[i] = value;
+        }
+    }
+
+  protected:
+    void consumeStripe(const char *stripe) {
+        accumulateStripe(acc, stripe, useSimd);
+        if (++stripesInBlock == stripesPerBlock) {
+            scramble(acc);
+            stripesInBlock = 0u;
+        }
+    }
+
+    static uint64_t readLE64(const char *data) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static uint64_t mul128Fold64(uint64_t lhs, uint64_t rhs) {
+        uint64_t lhsLow = lhs & 0xFFFFFFFFu;
+        uint64_t lhsHigh = lhs >> 32;
+        uint64_t rhsLow = rhs & 0xFFFFFFFFu;
+        uint64_t rhsHigh = rhs >> 32;
+
+        uint64_t lowLow = lhsLow * rhsLow;
+        uint64_t highLow = lhsHigh * rhsLow;
+        uint64_t lowHigh = lhsLow * rhsHigh;
+        uint64_t highHigh = lhsHigh * rhsHigh;
+
+        uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh;
+        uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+        uint64_t lower = (cross << 32) | (lowLow & 0xFFFFFFFFu);
+        return upper ^ lower;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 37;
+        value *= 0x165667919E3779F9ULL;
+        value ^= value >> 32;
+        return value;
+    }
+
+    static constexpr uint64_t prime32_1 = 0x9E3779B1U;
+    static constexpr uint64_t prime32_3 = 0xC2B2AE3DU;
+    static constexpr uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t secret[2 * numAccumulators] = {
+        0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+        0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL, 0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL};
+
+    uint64_t acc[numAccumulators];
+    uint64_t totalLength;
+    bool useSimd = true;
+    char buffer[stripeSize];
+    size_t bufferedSize;
+    size_t stripesInBlock;
+};
+
+} // namespace NEO
@@ -57,6 +57,11 @@ template <typename Vec, int simd>
 void generateLocalIDsSimd(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
                           const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
 
+struct uint16x32_t;
+template <>
+void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
+                                           const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+
 void generateLocalIDs(void *buffer, uint16_t simd, const std::array<uint16_t, 3> &localWorkgroupSize,
                       const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel, uint32_t grfSize);
 void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd);
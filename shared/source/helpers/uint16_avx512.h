@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace NEO {
+
+#if __AVX512F__ && __AVX512BW__
+struct uint16x32_t {
+    enum { numChannels = 32 };
+
+    __m512i value;
+
+    uint16x32_t() {
+        value = _mm512_setzero_si512();
+    }
+
+    uint16x32_t(__m512i value) : value(value) {
+    }
+
+    uint16x32_t(uint16_t a) {
+        value = _mm512_set1_epi16(a); // AVX512BW
+    }
+
+    explicit uint16x32_t(const void *alignedPtr) {
+        load(alignedPtr);
+    }
+
+    inline uint16_t get(unsigned int element) {
+        DEBUG_BREAK_IF(element >= numChannels);
+        return reinterpret_cast<uint16_t *>(&value)[element];
+    }
+
+    static inline uint16x32_t zero() {
+        return uint16x32_t(static_cast<uint16_t>(0u));
+    }
+
+    static inline uint16x32_t one() {
+        return uint16x32_t(static_cast<uint16_t>(1u));
+    }
+
+    // Local ID buffers and initialLocalID are only guaranteed to be 32 byte aligned,
+    // so aligned accesses use the unaligned forms, which cost nothing on 64 byte aligned data
+    inline void load(const void *alignedPtr) {
+        DEBUG_BREAK_IF(!isAligned<32>(alignedPtr));
+        value = _mm512_loadu_si512(alignedPtr); // AVX512F
+    }
+
+    inline void loadUnaligned(const void *ptr) {
+        value = _mm512_loadu_si512(ptr); // AVX512F
+    }
+
+    inline void store(void *alignedPtr) {
+        DEBUG_BREAK_IF(!isAligned<32>(alignedPtr));
+        _mm512_storeu_si512(alignedPtr, value); // AVX512F
+    }
+
+    inline void storeUnaligned(void *ptr) {
+        _mm512_storeu_si512(ptr, value); // AVX512F
+    }
+
+    inline uint16x32_t &operator-=(const uint16x32_t &a) {
+        value = _mm512_sub_epi16(value, a.value); // AVX512BW
+        return *this;
+    }
+
+    inline uint16x32_t &operator+=(const uint16x32_t &a) {
+        value = _mm512_add_epi16(value, a.value); // AVX512BW
+        return *this;
+    }
+
+    // Comparisons produce a lane mask register instead of a vector mask,
+    // so wrap handling is a compare followed by masked add/sub with no blend
+    inline friend __mmask32 operator>=(const uint16x32_t &a, const uint16x32_t &b) {
+        return _mm512_cmpge_epi16_mask(a.value, b.value); // AVX512BW
+    }
+
+    // lane = mask ? lane - a : lane
+    inline void maskedSub(__mmask32 mask, const uint16x32_t &a) {
+        value = _mm512_mask_sub_epi16(value, mask, value, a.value); // AVX512BW
+    }
+
+    // lane = mask ? lane + a : lane
+    inline void maskedAdd(__mmask32 mask, const uint16x32_t &a) {
+        value = _mm512_mask_add_epi16(value, mask, value, a.value); // AVX512BW
+    }
+};
+#endif // __AVX512F__ && __AVX512BW__
+} // namespace NEO
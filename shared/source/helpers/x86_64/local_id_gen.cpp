@@ -39,6 +39,10 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512);
+    if (supportsAVX512) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+    }
 }
 
 LocalIDHelper LocalIDHelper::initializer;
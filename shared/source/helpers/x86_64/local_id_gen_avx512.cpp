@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX512F__ && __AVX512BW__
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/uint16_avx512.h"
+
+#include <array>
+
+namespace NEO {
+
+// SIMD32 in a single pass with wraps kept in mask registers.
+// Produces the same layout as the generic generateLocalIDsSimd in local_id_gen.inl.
+template <>
+void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
+                                           const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize) {
+    uint32_t xDimNum = dimensionsOrder[0];
+    uint32_t yDimNum = dimensionsOrder[1];
+    uint32_t zDimNum = dimensionsOrder[2];
+
+    const uint16x32_t vLwsX(localWorkgroupSize[xDimNum]);
+    const uint16x32_t vLwsY(localWorkgroupSize[yDimNum]);
+    const auto one = uint16x32_t::one();
+
+    const auto threadSkipSize = 32 * sizeof(uint16_t);
+
+    // x -= xWrap ? lwsX : 0; y += xWrap ? 1 : 0; y -= yWrap ? lwsY : 0; z += yWrap ? 1 : 0;
+    auto wrap = [&](uint16x32_t &x, uint16x32_t &y, uint16x32_t &z) {
+        __mmask32 xWrap = x >= vLwsX;
+        x.maskedSub(xWrap, vLwsX);
+        y.maskedAdd(xWrap, one);
+
+        __mmask32 yWrap = y >= vLwsY;
+        y.maskedSub(yWrap, vLwsY);
+        z.maskedAdd(yWrap, one);
+        return (xWrap | yWrap) != 0;
+    };
+
+    // We need to convert simd into appropriate delta adders
+    uint16x32_t vSimdX(static_cast<uint16_t>(32u));
+    auto vSimdY = uint16x32_t::zero();
+    auto vSimdZ = uint16x32_t::zero();
+    while (wrap(vSimdX, vSimdY, vSimdZ)) {
+    }
+
+    // Convert the initial SIMD lanes to localIDs
+    uint16x32_t x(initialLocalID);
+    auto y = uint16x32_t::zero();
+    auto z = uint16x32_t::zero();
+    while (x >= vLwsX) {
+        wrap(x, y, z);
+    }
+
+    auto buffer = b;
+    for (size_t i = 0; i < threadsPerWorkGroup; ++i) {
+        x.store(ptrOffset(buffer, xDimNum * threadSkipSize));
+        y.store(ptrOffset(buffer, yDimNum * threadSkipSize));
+        z.store(ptrOffset(buffer, zDimNum * threadSkipSize));
+
+        x += vSimdX;
+        y += vSimdY;
+        z += vSimdZ;
+        wrap(x, y, z);
+
+        buffer = ptrOffset(buffer, 3 * threadSkipSize);
+    }
+}
+
+} // namespace NEO
+#endif
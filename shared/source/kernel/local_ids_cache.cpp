@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,22 +9,59 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/local_id_gen.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
 
+LocalIdsCache::LocalIdsCacheEntry::LocalIdsCacheEntry(const Vec3<uint16_t> &groupSize, size_t localIdsSize)
+    : groupSize(groupSize), localIdsSize(localIdsSize), localIdsData(static_cast<uint8_t *>(alignedMalloc(localIdsSize, 32))) {
+}
+
+LocalIdsCache::LocalIdsCacheEntry::~LocalIdsCacheEntry() {
+    alignedFree(localIdsData);
+}
+
+std::array<LocalIdsCache::ReaderSlot, LocalIdsCache::maxReaderSlots> LocalIdsCache::readerSlots;
+
+namespace {
+// Claims a reader slot for the lifetime of the thread, threads beyond the slot count read under the mutex
+template <typename ReaderSlotT, size_t count>
+struct ThreadReaderSlot {
+    ThreadReaderSlot(std::array<ReaderSlotT, count> &readerSlots) {
+        for (auto &readerSlot : readerSlots) {
+            bool expected = false;
+            if (!readerSlot.inUse.load(std::memory_order_relaxed) && readerSlot.inUse.compare_exchange_strong(expected, true)) {
+                slot = &readerSlot;
+                break;
+            }
+        }
+    }
+    ~ThreadReaderSlot() {
+        if (slot) {
+            slot->hazard.store(nullptr);
+            slot->inUse.store(false, std::memory_order_release);
+        }
+    }
+    ReaderSlotT *slot = nullptr;
+};
+} // namespace
+
 LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
+    : cache(cacheSize), wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
       grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
 }
 
 LocalIdsCache::~LocalIdsCache() {
-    for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
+    for (auto &cacheSlot : cache) {
+        delete cacheSlot.entry.load(std::memory_order_relaxed);
+    }
+    for (auto &retiredEntry : retiredEntries) {
+        delete retiredEntry;
     }
 }
 
@@ -42,39 +79,135 @@ size_t LocalIdsCache::getLocalIdsSizePerThread() const {
     return localIdsSizePerThread;
 }
 
+uint64_t LocalIdsCache::getCacheHits() const {
+    uint64_t hits = 0u;
+    for (auto &hitCounter : cacheHits) {
+        hits += hitCounter.value.load(std::memory_order_relaxed);
+    }
+    return hits;
+}
+
+uint64_t LocalIdsCache::getGroupKey(const Vec3<uint16_t> &group) {
+    constexpr uint64_t validKeyBit = 1ull << 48;
+    return validKeyBit | static_cast<uint64_t>(group[0]) | (static_cast<uint64_t>(group[1]) << 16) | (static_cast<uint64_t>(group[2]) << 32);
+}
+
+LocalIdsCache::ReaderSlot *LocalIdsCache::getReaderSlot() {
+    thread_local ThreadReaderSlot<ReaderSlot, maxReaderSlots> threadReaderSlot(readerSlots);
+    return threadReaderSlot.slot;
+}
+
+bool LocalIdsCache::isEntryInUse(const LocalIdsCacheEntry *entry) {
+    for (auto &readerSlot : readerSlots) {
+        if (readerSlot.hazard.load() == entry) {
+            return true;
+        }
+    }
+    return false;
+}
+
+LocalIdsCache::LocalIdsCacheEntry *LocalIdsCache::findEntry(const Vec3<uint16_t> &group) const {
+    const auto groupKey = getGroupKey(group);
+    for (auto &cacheSlot : cache) {
+        if (cacheSlot.groupKey.load(std::memory_order_relaxed) == groupKey) {
+            return cacheSlot.entry.load(std::memory_order_relaxed);
+        }
+    }
+    return nullptr;
+}
+
 void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
+    // Clock only advances on misses, so repeated hits do not write to shared cache lines
+    const auto now = accessClock.load(std::memory_order_relaxed);
+    if (entry.lastAccess.load(std::memory_order_relaxed) != now) {
+        entry.lastAccess.store(now, std::memory_order_relaxed);
+    }
     std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
 }
 
+bool LocalIdsCache::trySetLocalIdsFromPublishedEntry(const Vec3<uint16_t> &group, void *destination) {
+    auto readerSlot = getReaderSlot();
+    if (readerSlot == nullptr) {
+        return false;
+    }
+
+    const auto groupKey = getGroupKey(group);
+    for (auto &cacheSlot : cache) {
+        if (cacheSlot.groupKey.load(std::memory_order_relaxed) != groupKey) {
+            continue;
+        }
+        // Entry may only be dereferenced once the hazard is published and the slot still holds it
+        auto entry = cacheSlot.entry.load(std::memory_order_acquire);
+        readerSlot->hazard.store(entry);
+        bool entryProtected = entry != nullptr && cacheSlot.entry.load() == entry && entry->groupSize == group;
+        if (entryProtected) {
+            setLocalIdsForEntry(*entry, destination);
+        }
+        readerSlot->hazard.store(nullptr, std::memory_order_release);
+        if (entryProtected) {
+            const auto shard = static_cast<size_t>(readerSlot - readerSlots.data()) % hitCounterShards;
+            cacheHits[shard].value.fetch_add(1u, std::memory_order_relaxed);
+        }
+        return entryProtected;
+    }
+    return false;
+}
+
 void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination) {
+    if (trySetLocalIdsFromPublishedEntry(group, destination)) {
+        return;
+    }
+
     auto setLocalIdsLock = lock();
-    LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
-            return setLocalIdsForEntry(cacheEntry, destination);
-        }
+    auto entry = findEntry(group);
+    if (entry) {
+        setLocalIdsForEntry(*entry, destination);
+        cacheHits[0].value.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+    entry = commitNewEntry(group);
+    cacheMisses.fetch_add(1u, std::memory_order_relaxed);
+    std::memcpy(destination, entry->localIdsData, entry->localIdsSize);
+}
+
+LocalIdsCache::LocalIdsCacheEntry *LocalIdsCache::commitNewEntry(const Vec3<uint16_t> &group) {
+    auto newEntry = new LocalIdsCacheEntry(group, getLocalIdsSizeForGroup(group));
+    NEO::generateLocalIDs(newEntry->localIdsData, static_cast<uint16_t>(simdSize),
+                          {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize);
+    newEntry->lastAccess.store(accessClock.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    accessClock.store(accessClock.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
-            leastAccessedEntry = &cacheEntry;
+    auto *leastRecentlyUsed = &cache[0];
+    for (auto &cacheSlot : cache) {
+        auto entry = cacheSlot.entry.load(std::memory_order_relaxed);
+        if (entry == nullptr) {
+            leastRecentlyUsed = &cacheSlot;
+            break;
+        }
+        if (entry->lastAccess.load(std::memory_order_relaxed) < leastRecentlyUsed->entry.load(std::memory_order_relaxed)->lastAccess.load(std::memory_order_relaxed)) {
+            leastRecentlyUsed = &cacheSlot;
         }
     }
 
-    commitNewEntry(*leastAccessedEntry, group);
-    setLocalIdsForEntry(*leastAccessedEntry, destination);
+    auto evictedEntry = leastRecentlyUsed->entry.exchange(newEntry);
+    leastRecentlyUsed->groupKey.store(getGroupKey(group), std::memory_order_relaxed);
+    if (evictedEntry) {
+        retiredEntries.push_back(evictedEntry);
+    }
+    releaseRetiredEntries();
+    return newEntry;
 }
 
-void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group) {
-    entry.localIdsSize = getLocalIdsSizeForGroup(group);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
-    if (entry.localIdsSize > entry.localIdsSizeAllocated) {
-        alignedFree(entry.localIdsData);
-        entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
-        entry.localIdsSizeAllocated = entry.localIdsSize;
-    }
-    NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
-                          {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize);
+void LocalIdsCache::releaseRetiredEntries() {
+    // Each reader protects at most one entry, so at most maxReaderSlots retired entries stay alive
+    auto stillInUse = std::remove_if(retiredEntries.begin(), retiredEntries.end(), [](LocalIdsCacheEntry *retiredEntry) {
+        if (isEntryInUse(retiredEntry)) {
+            return false;
+        }
+        delete retiredEntry;
+        return true;
+    });
+    retiredEntries.erase(stillInUse, retiredEntries.end());
 }
 
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -1,28 +1,41 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 
+// Caches generated local ids per work group size.
+// Entries are immutable once published, so lookups do not take the mutex; it is only
+// taken on a miss to generate and publish a new entry in place of the least recently used one.
+// A reader protects the entry it copies from with a per-thread hazard pointer, evicted entries
+// are freed on later misses once no hazard points at them.
 class LocalIdsCache {
   public:
     struct LocalIdsCacheEntry {
-        Vec3<uint16_t> groupSize = {0, 0, 0};
-        uint8_t *localIdsData = nullptr;
-        size_t localIdsSize = 0U;
-        size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
+        LocalIdsCacheEntry(const Vec3<uint16_t> &groupSize, size_t localIdsSize);
+        ~LocalIdsCacheEntry();
+        LocalIdsCacheEntry(const LocalIdsCacheEntry &) = delete;
+        LocalIdsCacheEntry &operator=(const LocalIdsCacheEntry &) = delete;
+
+        const Vec3<uint16_t> groupSize;
+        const size_t localIdsSize;
+        uint8_t *const localIdsData;
+        std::atomic<uint64_t> lastAccess{0u};
     };
 
+    static constexpr size_t defaultCacheSize = 16u;
+
     LocalIdsCache() = delete;
     LocalIdsCache(LocalIdsCache &) = delete;
     LocalIdsCache &operator=(const LocalIdsCache &other) = delete;
@@ -34,12 +47,46 @@ class LocalIdsCache {
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group) const;
     size_t getLocalIdsSizePerThread() const;
 
+    size_t getCacheSize() const { return cache.size(); }
+    uint64_t getCacheHits() const;
+    uint64_t getCacheMisses() const { return cacheMisses.load(std::memory_order_relaxed); }
+
   protected:
+    struct CacheSlot {
+        std::atomic<uint64_t> groupKey{0u};
+        std::atomic<LocalIdsCacheEntry *> entry{nullptr};
+    };
+
+    struct alignas(MemoryConstants::cacheLineSize) ReaderSlot {
+        std::atomic<const LocalIdsCacheEntry *> hazard{nullptr};
+        std::atomic<bool> inUse{false};
+    };
+
+    struct alignas(MemoryConstants::cacheLineSize) HitCounter {
+        std::atomic<uint64_t> value{0u};
+    };
+
+    static constexpr size_t maxReaderSlots = 256u;
+    static constexpr size_t hitCounterShards = 8u;
+
+    static uint64_t getGroupKey(const Vec3<uint16_t> &group);
+    static ReaderSlot *getReaderSlot();
+    static bool isEntryInUse(const LocalIdsCacheEntry *entry);
+
+    LocalIdsCacheEntry *findEntry(const Vec3<uint16_t> &group) const;
+    bool trySetLocalIdsFromPublishedEntry(const Vec3<uint16_t> &group, void *destination);
     void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
-    void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group);
+    LocalIdsCacheEntry *commitNewEntry(const Vec3<uint16_t> &group);
+    void releaseRetiredEntries();
     std::unique_lock<std::mutex> lock();
 
-    StackVec<LocalIdsCacheEntry, 4> cache;
+    static std::array<ReaderSlot, maxReaderSlots> readerSlots;
+
+    std::vector<CacheSlot> cache;
+    std::vector<LocalIdsCacheEntry *> retiredEntries;
+    std::atomic<uint64_t> accessClock{0u};
+    std::array<HitCounter, hitCounterShards> cacheHits;
+    std::atomic<uint64_t> cacheMisses{0u};
     std::mutex setLocalIdsMutex;
     const std::array<uint8_t, 3> wgDimOrder;
     const uint32_t localIdsSizePerThread;
@@ -47,4 +94,4 @@ class LocalIdsCache {
     const uint8_t simdSize;
     const bool usesOnlyImages;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -23,6 +23,20 @@ struct ReusableAllocationRequirements {
     uint32_t tagOffset;
 };
 
+struct EvictionRequirements {
+    ReusableAllocationRequirements allocationRequirements;
+    size_t maxTotalSize;
+    TaskCountType maxAge;
+    TaskCountType currentTaskCount;
+};
+
+void initRequirements(ReusableAllocationRequirements &req, NEO::CommandStreamReceiver *commandStreamReceiver) {
+    req.csrTagAddress = (commandStreamReceiver == nullptr) ? nullptr : commandStreamReceiver->getTagAddress();
+    req.contextId = (commandStreamReceiver == nullptr) ? UINT32_MAX : commandStreamReceiver->getOsContext().getContextId();
+    req.activeTileCount = (commandStreamReceiver == nullptr) ? 1u : commandStreamReceiver->getActivePartitions();
+    req.tagOffset = (commandStreamReceiver == nullptr) ? 0u : commandStreamReceiver->getPostSyncWriteOffset();
+}
+
 bool checkTagAddressReady(ReusableAllocationRequirements *requirements, NEO::GraphicsAllocation *gfxAllocation) {
     auto tagAddress = requirements->csrTagAddress;
     auto taskCount = gfxAllocation->getTaskCount(requirements->contextId);
@@ -35,6 +49,14 @@ bool checkTagAddressReady(ReusableAllocationRequirements *requirements, NEO::Gra
 
     return true;
 }
+
+bool canBeDetached(ReusableAllocationRequirements *requirements, NEO::AllocationUsage allocationUsage, NEO::GraphicsAllocation *gfxAllocation) {
+    if (requirements->csrTagAddress == nullptr) {
+        return true;
+    }
+    return (allocationUsage == NEO::TEMPORARY_ALLOCATION || checkTagAddressReady(requirements, gfxAllocation)) &&
+           (requirements->requiredPtr == nullptr || requirements->requiredPtr == gfxAllocation->getUnderlyingBuffer());
+}
 } // namespace
 
 namespace NEO {
@@ -43,13 +65,10 @@ AllocationsList::AllocationsList(AllocationUsage allocationUsage)
 
 std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType) {
     ReusableAllocationRequirements req;
+    initRequirements(req, commandStreamReceiver);
     req.requiredMinimalSize = requiredMinimalSize;
-    req.csrTagAddress = (commandStreamReceiver == nullptr) ? nullptr : commandStreamReceiver->getTagAddress();
     req.allocationType = allocationType;
-    req.contextId = (commandStreamReceiver == nullptr) ? UINT32_MAX : commandStreamReceiver->getOsContext().getContextId();
     req.requiredPtr = requiredPtr;
-    req.activeTileCount = (commandStreamReceiver == nullptr) ? 1u : commandStreamReceiver->getActivePartitions();
-    req.tagOffset = (commandStreamReceiver == nullptr) ? 0u : commandStreamReceiver->getPostSyncWriteOffset();
     GraphicsAllocation *a = nullptr;
     GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
@@ -57,25 +76,73 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
 
 GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize)) {
-            if (req->csrTagAddress == nullptr) {
-                return removeOneImpl(curr, nullptr);
+    GraphicsAllocation *found = nullptr;
+    if (isIndexed()) {
+        for (auto it = index.lower_bound(IndexKey{req->allocationType, req->requiredMinimalSize}); it != index.end() && it->first.first == req->allocationType; ++it) {
+            if (canBeDetached(req, allocationUsage, it->second)) {
+                found = it->second;
+                totalSize -= it->first.second;
+                index.erase(it);
+                break;
             }
-            if ((this->allocationUsage == TEMPORARY_ALLOCATION || checkTagAddressReady(req, curr)) &&
-                (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
-                if (this->allocationUsage == TEMPORARY_ALLOCATION) {
-                    // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
-                    curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
-                }
-                return removeOneImpl(curr, nullptr);
+        }
+    } else {
+        for (auto curr = head; curr != nullptr; curr = curr->next) {
+            if ((req->allocationType == curr->getAllocationType()) &&
+                (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
+                canBeDetached(req, allocationUsage, curr)) {
+                found = curr;
+                break;
             }
         }
-        curr = curr->next;
     }
-    return nullptr;
+
+    if (found == nullptr) {
+        reuseStatistics.misses++;
+        return nullptr;
+    }
+    reuseStatistics.hits++;
+
+    if (this->allocationUsage == TEMPORARY_ALLOCATION && req->csrTagAddress != nullptr) {
+        // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
+        found->updateTaskCount(CompletionStamp::notReady, req->contextId);
+    }
+    return removeOneImpl(found, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachAllocationsToEvict(size_t maxTotalSize, TaskCountType maxAge, CommandStreamReceiver &commandStreamReceiver) {
+    EvictionRequirements req;
+    initRequirements(req.allocationRequirements, &commandStreamReceiver);
+    req.maxTotalSize = maxTotalSize;
+    req.maxAge = maxAge;
+    req.currentTaskCount = commandStreamReceiver.peekTaskCount();
+    return processLocked<AllocationsList, &AllocationsList::detachAllocationsToEvictImpl>(nullptr, static_cast<void *>(&req));
+}
+
+GraphicsAllocation *AllocationsList::detachAllocationsToEvictImpl(GraphicsAllocation *, void *data) {
+    EvictionRequirements *req = static_cast<EvictionRequirements *>(data);
+
+    IDList<GraphicsAllocation, false, true> evictedAllocations;
+    auto *curr = head;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        auto taskCount = curr->getTaskCount(req->allocationRequirements.contextId);
+        auto age = (taskCount < req->currentTaskCount) ? req->currentTaskCount - taskCount : 0u;
+        if (totalSize <= req->maxTotalSize && age <= req->maxAge) {
+            // allocations are stored in task count order, the rest is younger
+            break;
+        }
+        if (curr->hostPtrTaskCountAssignment == 0 &&
+            checkTagAddressReady(&req->allocationRequirements, curr)) {
+            auto size = curr->getUnderlyingBufferSize();
+            removeOneIndexedImpl(curr, nullptr);
+            evictedAllocations.pushTailOne(*curr);
+            reuseStatistics.evictedAllocations++;
+            reuseStatistics.evictedBytes += size;
+        }
+        curr = next;
+    }
+    return evictedAllocations.detachNodes();
 }
 
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
@@ -86,5 +153,113 @@ void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
         curr = currNext;
     }
     head = nullptr;
+    clearIndex();
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&node);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&node));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&nodes);
+}
+
+void AllocationsList::deleteAll() {
+    GraphicsAllocation *nodes = detachNodes();
+    if (nodes != nullptr) {
+        nodes->deleteThisAndAllNext();
+    }
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushFrontOneImpl(node, nullptr);
+    addToIndex(node);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushTailOneImpl(node, nullptr);
+    addToIndex(node);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *node, void *) {
+    removeFromIndex(node);
+    return removeOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *first, void *last) {
+    auto sequence = detachSequenceImpl(first, last);
+    for (auto curr = sequence; curr != nullptr; curr = curr->next) {
+        removeFromIndex(curr);
+    }
+    return sequence;
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    clearIndex();
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *nodes, void *) {
+    for (auto curr = nodes; curr != nullptr; curr = curr->next) {
+        addToIndex(curr);
+    }
+    return spliceImpl(nodes, nullptr);
+}
+
+void AllocationsList::addToIndex(GraphicsAllocation *allocation) {
+    if (!isIndexed()) {
+        return;
+    }
+    auto size = allocation->getUnderlyingBufferSize();
+    index.emplace(IndexKey{allocation->getAllocationType(), size}, allocation);
+    totalSize += size;
+}
+
+void AllocationsList::removeFromIndex(GraphicsAllocation *allocation) {
+    if (!isIndexed()) {
+        return;
+    }
+    auto range = index.equal_range(IndexKey{allocation->getAllocationType(), allocation->getUnderlyingBufferSize()});
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == allocation) {
+            totalSize -= it->first.second;
+            index.erase(it);
+            return;
+        }
+    }
+}
+
+void AllocationsList::clearIndex() {
+    index.clear();
+    totalSize = 0u;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,22 +10,71 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <map>
 #include <memory>
 
 namespace NEO {
 class CommandStreamReceiver;
 
-class AllocationsList : public IDList<GraphicsAllocation, true, true> {
+class AllocationsList : protected IDList<GraphicsAllocation, true, true> {
+    using BaseType = IDList<GraphicsAllocation, true, true>;
+    friend BaseType;
+
   public:
+    struct ReuseStatistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictedAllocations = 0u;
+        uint64_t evictedBytes = 0u;
+    };
+
     AllocationsList() = default;
     AllocationsList(AllocationUsage allocationUsage);
 
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
+    GraphicsAllocation *detachAllocationsToEvict(size_t maxTotalSize, TaskCountType maxAge, CommandStreamReceiver &commandStreamReceiver);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
-  private:
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+    void deleteAll();
+
+    using BaseType::peekContains;
+    using BaseType::peekHead;
+    using BaseType::peekIsEmpty;
+    using BaseType::peekTail;
+
+    size_t getTotalSize() const { return totalSize; }
+    ReuseStatistics getReuseStatistics() const { return reuseStatistics; }
+
+  protected:
+    // reusable allocations are additionally indexed by type and size, so that lookups pick the smallest fitting allocation
+    using IndexKey = std::pair<AllocationType, size_t>;
+    using Index = std::multimap<IndexKey, GraphicsAllocation *>;
+
+    bool isIndexed() const { return allocationUsage == REUSABLE_ALLOCATION; }
+    void addToIndex(GraphicsAllocation *allocation);
+    void removeFromIndex(GraphicsAllocation *allocation);
+    void clearIndex();
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachAllocationsToEvictImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *first, void *last);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *nodes, void *);
 
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
+    Index index;
+    size_t totalSize = 0u;
+    ReuseStatistics reuseStatistics;
 };
 } // namespace NEO
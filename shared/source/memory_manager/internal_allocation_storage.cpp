@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,36 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
     auto &allocationsList = allocationLists[allocationUsage];
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
     allocationsList.pushTailOne(*gfxAllocation.release());
+
+    if (allocationUsage == REUSABLE_ALLOCATION) {
+        evictReusableAllocations();
+    }
+}
+
+void InternalAllocationStorage::evictReusableAllocations() {
+    auto maxTotalSize = std::numeric_limits<size_t>::max();
+    auto maxAge = std::numeric_limits<TaskCountType>::max();
+    if (DebugManager.flags.ReusableAllocationsMaxTotalSize.get() != -1) {
+        maxTotalSize = static_cast<size_t>(DebugManager.flags.ReusableAllocationsMaxTotalSize.get());
+    }
+    if (DebugManager.flags.ReusableAllocationsMaxAge.get() != -1) {
+        maxAge = static_cast<TaskCountType>(DebugManager.flags.ReusableAllocationsMaxAge.get());
+    }
+
+    auto &allocationsList = allocationLists[REUSABLE_ALLOCATION];
+    if (allocationsList.getTotalSize() <= maxTotalSize && maxAge == std::numeric_limits<TaskCountType>::max()) {
+        return;
+    }
+
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+
+    GraphicsAllocation *curr = allocationsList.detachAllocationsToEvict(maxTotalSize, maxAge, commandStreamReceiver);
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        memoryManager->freeGraphicsMemory(curr);
+        curr = next;
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(TaskCountType waitTaskCount, uint32_t allocationUsage) {
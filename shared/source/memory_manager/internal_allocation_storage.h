@@ -28,6 +28,7 @@ class InternalAllocationStorage {
 
   protected:
     void freeAllocationsList(TaskCountType waitTaskCount, AllocationsList &allocationsList);
+    void evictReusableAllocations();
     CommandStreamReceiver &commandStreamReceiver;
 
     std::array<AllocationsList, 3> allocationLists = {AllocationsList(TEMPORARY_ALLOCATION), AllocationsList(REUSABLE_ALLOCATION), AllocationsList(DEFERRED_DEALLOCATION)};
@@ -24,6 +24,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> SVMAllocsManager::MapBasedAllocationTracker::trackersCreated = 0u;
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
     allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
 }
@@ -32,25 +34,57 @@ void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData alloc
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     allocations.erase(iter);
+    removalsCount.fetch_add(1u, std::memory_order_release);
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::CacheKeyHash::operator()(const CacheKey &key) const {
+    size_t hash = std::hash<const void *>()(key.device);
+    hash ^= std::hash<uint64_t>()((static_cast<uint64_t>(key.allFlags) << 32) | key.allAllocFlags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<uint64_t>()(key.rootDeviceIndicesMask) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+uint32_t SVMAllocsManager::SvmAllocationCache::getSizeClass(size_t size) {
+    return Math::log2(static_cast<uint64_t>(std::max(size, static_cast<size_t>(1u))));
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, const CacheKey &key, SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    auto now = std::chrono::steady_clock::now();
+    trimOldAllocationsImpl(now, svmAllocsManager);
+    if (size > maxSize) {
+        return false;
+    }
+    while (cachedSize + size > maxSize) {
+        releaseOldestAllocation(svmAllocsManager);
+    }
+
+    auto &bucket = buckets[key][getSizeClass(size)];
+    auto entry = allocations.emplace(allocations.end(), size, ptr, now, &bucket);
+    auto position = std::lower_bound(bucket.begin(), bucket.end(), size, [](const EntryList::iterator &entry, size_t allocationSize) { return entry->allocationSize < allocationSize; });
+    bucket.insert(position, entry);
+    cachedSize += size;
+    return true;
 }
 
-void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
+void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const CacheKey &key) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        void *allocationPtr = allocationIter->allocation;
-        SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
-        UNRECOVERABLE_IF(!svmAllocData);
-        if (svmAllocData->device == unifiedMemoryProperties.device &&
-            svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
-            allocations.erase(allocationIter);
+    auto bucketsIter = buckets.find(key);
+    if (bucketsIter == buckets.end()) {
+        return nullptr;
+    }
+    auto &sizeClassBuckets = bucketsIter->second;
+    auto sizeClass = getSizeClass(size);
+    auto lastSizeClass = std::min(sizeClass + maxSizeClassesAboveRequested, numSizeClasses - 1);
+    for (; sizeClass <= lastSizeClass; ++sizeClass) {
+        auto &bucket = sizeClassBuckets[sizeClass];
+        auto position = std::lower_bound(bucket.begin(), bucket.end(), size, [](const EntryList::iterator &entry, size_t allocationSize) { return entry->allocationSize < allocationSize; });
+        if (position != bucket.end()) {
+            auto entry = *position;
+            void *allocationPtr = entry->allocation;
+            cachedSize -= entry->allocationSize;
+            bucket.erase(position);
+            allocations.erase(entry);
             return allocationPtr;
         }
     }
@@ -65,6 +99,43 @@ void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManag
         svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::POLICY_NONE, svmData);
     }
     this->allocations.clear();
+    this->buckets.clear();
+    this->cachedSize = 0u;
+}
+
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocations(TimePoint now, SVMAllocsManager *svmAllocsManager) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    trimOldAllocationsImpl(now, svmAllocsManager);
+}
+
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocationsImpl(TimePoint now, SVMAllocsManager *svmAllocsManager) {
+    if (maxAge == std::chrono::milliseconds::max()) {
+        return;
+    }
+    while (!allocations.empty() && now - allocations.front().insertTime > maxAge) {
+        releaseOldestAllocation(svmAllocsManager);
+    }
+}
+
+void SVMAllocsManager::SvmAllocationCache::releaseOldestAllocation(SVMAllocsManager *svmAllocsManager) {
+    auto oldest = allocations.begin();
+    removeFromBucket(oldest);
+    cachedSize -= oldest->allocationSize;
+    void *allocationPtr = oldest->allocation;
+    allocations.erase(oldest);
+
+    SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(allocationPtr);
+    DEBUG_BREAK_IF(nullptr == svmData);
+    svmAllocsManager->freeSVMAllocImpl(allocationPtr, FreePolicyType::POLICY_NONE, svmData);
+}
+
+void SVMAllocsManager::SvmAllocationCache::removeFromBucket(EntryList::iterator cachedAllocation) {
+    auto &bucket = *cachedAllocation->bucket;
+    auto position = std::lower_bound(bucket.begin(), bucket.end(), cachedAllocation->allocationSize, [](const EntryList::iterator &entry, size_t allocationSize) { return entry->allocationSize < allocationSize; });
+    while (*position != cachedAllocation) {
+        ++position;
+    }
+    bucket.erase(position);
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -163,7 +234,19 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
         this->usmDeviceAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get();
     }
     if (this->usmDeviceAllocationsCacheEnabled) {
-        this->initUsmDeviceAllocationsCache();
+        this->initUsmAllocationsCache(this->usmDeviceAllocationsCache);
+    }
+    if (DebugManager.flags.ExperimentalEnableHostAllocationCache.get() != -1) {
+        this->usmHostAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableHostAllocationCache.get();
+    }
+    if (this->usmHostAllocationsCacheEnabled) {
+        this->initUsmAllocationsCache(this->usmHostAllocationsCache);
+    }
+    if (DebugManager.flags.ExperimentalEnableSharedAllocationCache.get() != -1) {
+        this->usmSharedAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableSharedAllocationCache.get();
+    }
+    if (this->usmSharedAllocationsCacheEnabled) {
+        this->initUsmAllocationsCache(this->usmSharedAllocationsCache);
     }
 }
 
@@ -216,7 +299,18 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     SvmAllocationData allocData(maxRootDeviceIndex);
     void *externalHostPointer = reinterpret_cast<void *>(memoryProperties.allocationFlags.hostptr);
 
+    if (externalHostPointer == nullptr) {
+        void *allocationFromCache = this->getFromUsmAllocationsCache(size, memoryProperties, nullptr, rootDeviceIndicesVector);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     void *usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    if (!usmPtr && this->getUsmAllocationsCache(memoryProperties.memoryType)) {
+        this->trimUSMAllocCaches();
+        usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -273,21 +367,21 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
 
     if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = true;
-        if (this->usmDeviceAllocationsCacheEnabled) {
-            void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties, this);
-            if (allocationFromCache) {
-                return allocationFromCache;
-            }
-        }
     } else if (memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
         unifiedMemoryProperties.flags.isUSMHostAllocation = true;
     }
 
+    if (memoryProperties.memoryType != InternalMemoryType::HOST_UNIFIED_MEMORY) {
+        void *allocationFromCache = this->getFromUsmAllocationsCache(size, memoryProperties, memoryProperties.device, RootDeviceIndicesContainer{rootDeviceIndex});
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     GraphicsAllocation *unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
     if (!unifiedMemoryAllocation) {
-        if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->trimUSMDeviceAllocCache();
+        if (this->getUsmAllocationsCache(memoryProperties.memoryType)) {
+            this->trimUSMAllocCaches();
             unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
         }
         if (!unifiedMemoryAllocation) {
@@ -329,6 +423,13 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
         void *unifiedMemoryPointer = nullptr;
 
         if (useKmdMigration) {
+            auto rootDeviceIndex = memoryProperties.device
+                                       ? memoryProperties.device->getRootDeviceIndex()
+                                       : *memoryProperties.rootDeviceIndices.begin();
+            void *allocationFromCache = this->getFromUsmAllocationsCache(size, memoryProperties, memoryProperties.device, RootDeviceIndicesContainer{rootDeviceIndex});
+            if (allocationFromCache) {
+                return allocationFromCache;
+            }
             unifiedMemoryPointer = createUnifiedKmdMigratedAllocation(size, {}, memoryProperties);
             if (!unifiedMemoryPointer) {
                 return nullptr;
@@ -398,9 +499,46 @@ void SVMAllocsManager::setUnifiedAllocationProperties(GraphicsAllocation *alloca
     allocation->setCoherent(svmProperties.coherent);
 }
 
+namespace {
+// Per-thread memo of recent getSVMAlloc results. An entry stays valid while its tracker
+// has not removed any allocation since the entry was filled; inserts never overlap
+// tracked ranges, so they cannot make a hit stale.
+struct SvmLookupCache {
+    struct Entry {
+        uint64_t trackerId = 0u;
+        uint64_t removalsCount = 0u;
+        uintptr_t begin = 0u;
+        uintptr_t end = 0u;
+        SvmAllocationData *svmData = nullptr;
+    };
+    static constexpr uint32_t numEntries = 4u;
+    std::array<Entry, numEntries> entries;
+    uint32_t nextEntry = 0u;
+};
+thread_local SvmLookupCache svmLookupCache;
+} // namespace
+
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto removalsCount = SVMAllocs.removalsCount.load(std::memory_order_acquire);
+    for (auto &entry : svmLookupCache.entries) {
+        if (entry.trackerId == SVMAllocs.trackerId && entry.removalsCount == removalsCount &&
+            address >= entry.begin && address < entry.end) {
+            return entry.svmData;
+        }
+    }
+
     std::shared_lock<std::shared_mutex> lock(mtx);
-    return SVMAllocs.get(ptr);
+    auto svmData = SVMAllocs.get(ptr);
+    if (svmData) {
+        auto &entry = svmLookupCache.entries[svmLookupCache.nextEntry++ % SvmLookupCache::numEntries];
+        entry.trackerId = SVMAllocs.trackerId;
+        entry.removalsCount = SVMAllocs.removalsCount.load(std::memory_order_relaxed);
+        entry.begin = static_cast<uintptr_t>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
+        entry.end = entry.begin + svmData->size;
+        entry.svmData = svmData;
+    }
+    return svmData;
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMDeferFreeAlloc(const void *ptr) {
@@ -426,9 +564,7 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
 
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+        if (this->insertIntoUsmAllocationsCache(ptr, svmData)) {
             return true;
         }
         if (blocking) {
@@ -449,9 +585,7 @@ bool SVMAllocsManager::freeSVMAllocDefer(void *ptr) {
 
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+        if (this->insertIntoUsmAllocationsCache(ptr, svmData)) {
             return true;
         }
         this->freeSVMAllocImpl(ptr, FreePolicyType::POLICY_DEFER, svmData);
@@ -524,6 +658,20 @@ void SVMAllocsManager::trimUSMDeviceAllocCache() {
     this->usmDeviceAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUSMHostAllocCache() {
+    this->usmHostAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMSharedAllocCache() {
+    this->usmSharedAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMAllocCaches() {
+    this->trimUSMDeviceAllocCache();
+    this->trimUSMHostAllocCache();
+    this->trimUSMSharedAllocCache();
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -642,8 +790,77 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     }
 }
 
-void SVMAllocsManager::initUsmDeviceAllocationsCache() {
-    this->usmDeviceAllocationsCache.allocations.reserve(128u);
+void SVMAllocsManager::initUsmAllocationsCache(SvmAllocationCache &cache) {
+    if (DebugManager.flags.ExperimentalAllocationCacheMaxSize.get() != -1) {
+        cache.maxSize = static_cast<size_t>(DebugManager.flags.ExperimentalAllocationCacheMaxSize.get());
+    }
+    if (DebugManager.flags.ExperimentalAllocationCacheMaxAge.get() != -1) {
+        cache.maxAge = std::chrono::milliseconds(DebugManager.flags.ExperimentalAllocationCacheMaxAge.get());
+    }
+}
+
+SVMAllocsManager::SvmAllocationCache *SVMAllocsManager::getUsmAllocationsCache(InternalMemoryType memoryType) {
+    switch (memoryType) {
+    case InternalMemoryType::DEVICE_UNIFIED_MEMORY:
+        return this->usmDeviceAllocationsCacheEnabled ? &this->usmDeviceAllocationsCache : nullptr;
+    case InternalMemoryType::HOST_UNIFIED_MEMORY:
+        return this->usmHostAllocationsCacheEnabled ? &this->usmHostAllocationsCache : nullptr;
+    case InternalMemoryType::SHARED_UNIFIED_MEMORY:
+        return this->usmSharedAllocationsCacheEnabled ? &this->usmSharedAllocationsCache : nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+bool SVMAllocsManager::insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData) {
+    auto cache = this->getUsmAllocationsCache(svmData->memoryType);
+    if (!cache) {
+        return false;
+    }
+    // dual storage allocations are tracked by page fault manager, imported and user pointer allocations are not owned
+    if (svmData->cpuAllocation || svmData->isImportedAllocation || svmData->allocationFlagsProperty.hostptr) {
+        return false;
+    }
+
+    RootDeviceIndicesContainer rootDeviceIndices;
+    for (auto allocation : svmData->gpuAllocations.getGraphicsAllocations()) {
+        if (allocation) {
+            rootDeviceIndices.push_back(allocation->getRootDeviceIndex());
+        }
+    }
+    SvmAllocationCache::CacheKey key;
+    if (!getUsmAllocationsCacheKey(key, svmData->device, svmData->allocationFlagsProperty, rootDeviceIndices)) {
+        return false;
+    }
+    return cache->insert(svmData->size, ptr, key, this);
+}
+
+void *SVMAllocsManager::getFromUsmAllocationsCache(size_t size, const UnifiedMemoryProperties &memoryProperties, Device *device, const RootDeviceIndicesContainer &rootDeviceIndices) {
+    auto cache = this->getUsmAllocationsCache(memoryProperties.memoryType);
+    if (!cache) {
+        return nullptr;
+    }
+
+    SvmAllocationCache::CacheKey key;
+    if (!getUsmAllocationsCacheKey(key, device, memoryProperties.allocationFlags, rootDeviceIndices)) {
+        return nullptr;
+    }
+    return cache->get(size, key);
+}
+
+bool SVMAllocsManager::getUsmAllocationsCacheKey(SvmAllocationCache::CacheKey &key, Device *device, const MemoryProperties &allocationFlags, const RootDeviceIndicesContainer &rootDeviceIndices) {
+    key.device = device;
+    key.allFlags = allocationFlags.allFlags;
+    key.allAllocFlags = allocationFlags.allAllocFlags;
+    key.memCacheClos = allocationFlags.memCacheClos;
+    key.rootDeviceIndicesMask = 0u;
+    for (auto rootDeviceIndex : rootDeviceIndices) {
+        if (rootDeviceIndex >= std::numeric_limits<uint64_t>::digits) {
+            return false;
+        }
+        key.rootDeviceIndicesMask |= (1ull << rootDeviceIndex);
+    }
+    return true;
 }
 
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
@@ -14,11 +14,16 @@
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <limits>
+#include <list>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -88,6 +93,11 @@ class SVMAllocsManager {
         size_t getNumAllocs() const { return allocations.size(); };
 
         SvmAllocationContainer allocations;
+
+      protected:
+        static std::atomic<uint64_t> trackersCreated;
+        const uint64_t trackerId = ++trackersCreated;
+        std::atomic<uint64_t> removalsCount = 0u;
     };
 
     struct MapOperationsTracker {
@@ -126,23 +136,59 @@ class SVMAllocsManager {
     };
 
     struct SvmCacheAllocationInfo {
+        using SizeClassBucket = std::vector<std::list<SvmCacheAllocationInfo>::iterator>;
         size_t allocationSize;
         void *allocation;
-        SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation) {}
-        bool operator<(SvmCacheAllocationInfo const &other) {
-            return allocationSize < other.allocationSize;
-        }
-        bool operator<(size_t const &size) {
-            return allocationSize < size;
-        }
+        std::chrono::steady_clock::time_point insertTime;
+        SizeClassBucket *bucket;
+        SvmCacheAllocationInfo(size_t allocationSize, void *allocation, std::chrono::steady_clock::time_point insertTime, SizeClassBucket *bucket)
+            : allocationSize(allocationSize), allocation(allocation), insertTime(insertTime), bucket(bucket) {}
     };
 
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
-        void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
+        using TimePoint = std::chrono::steady_clock::time_point;
+        using EntryList = std::list<SvmCacheAllocationInfo>;
+        using SizeClassBucket = SvmCacheAllocationInfo::SizeClassBucket;
+
+        static constexpr uint32_t numSizeClasses = 64u;
+        // allocation from the next size class up may be handed out, wasting less than 4x the requested size
+        static constexpr uint32_t maxSizeClassesAboveRequested = 1u;
+
+        struct CacheKey {
+            Device *device = nullptr;
+            uint32_t allFlags = 0u;
+            uint32_t allAllocFlags = 0u;
+            uint32_t memCacheClos = 0u;
+            uint64_t rootDeviceIndicesMask = 0u;
+            bool operator==(const CacheKey &other) const {
+                return device == other.device && allFlags == other.allFlags && allAllocFlags == other.allAllocFlags &&
+                       memCacheClos == other.memCacheClos && rootDeviceIndicesMask == other.rootDeviceIndicesMask;
+            }
+        };
+        struct CacheKeyHash {
+            size_t operator()(const CacheKey &key) const;
+        };
+        using SizeClassBuckets = std::array<SizeClassBucket, numSizeClasses>;
+
+        static uint32_t getSizeClass(size_t size);
+
+        bool insert(size_t size, void *ptr, const CacheKey &key, SVMAllocsManager *svmAllocsManager);
+        void *get(size_t size, const CacheKey &key);
         void trim(SVMAllocsManager *svmAllocsManager);
-        std::vector<SvmCacheAllocationInfo> allocations;
+        void trimOldAllocations(TimePoint now, SVMAllocsManager *svmAllocsManager);
+        size_t getCachedSize() const { return cachedSize; }
+
+        EntryList allocations; // ordered from the oldest
+        std::unordered_map<CacheKey, SizeClassBuckets, CacheKeyHash> buckets;
+        size_t cachedSize = 0u;
+        size_t maxSize = std::numeric_limits<size_t>::max();
+        std::chrono::milliseconds maxAge = std::chrono::milliseconds::max();
         std::mutex mtx;
+
+      protected:
+        void trimOldAllocationsImpl(TimePoint now, SVMAllocsManager *svmAllocsManager);
+        void releaseOldestAllocation(SVMAllocsManager *svmAllocsManager);
+        void removeFromBucket(EntryList::iterator cachedAllocation);
     };
 
     enum class FreePolicyType : uint32_t {
@@ -176,11 +222,15 @@ class SVMAllocsManager {
     MOCKABLE_VIRTUAL void freeSVMAllocImpl(void *ptr, FreePolicyType policy, SvmAllocationData *svmData);
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
+    void trimUSMHostAllocCache();
+    void trimUSMSharedAllocCache();
+    void trimUSMAllocCaches();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
     MOCKABLE_VIRTUAL size_t getNumDeferFreeAllocs() const { return SVMDeferFreeAllocs.getNumAllocs(); }
     MapBasedAllocationTracker *getSVMAllocs() { return &SVMAllocs; }
+    MemoryManager *getMemoryManager() const { return memoryManager; }
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
@@ -211,7 +261,11 @@ class SVMAllocsManager {
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
-    void initUsmDeviceAllocationsCache();
+    void initUsmAllocationsCache(SvmAllocationCache &cache);
+    SvmAllocationCache *getUsmAllocationsCache(InternalMemoryType memoryType);
+    bool insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData);
+    void *getFromUsmAllocationsCache(size_t size, const UnifiedMemoryProperties &memoryProperties, Device *device, const RootDeviceIndicesContainer &rootDeviceIndices);
+    static bool getUsmAllocationsCacheKey(SvmAllocationCache::CacheKey &key, Device *device, const MemoryProperties &allocationFlags, const RootDeviceIndicesContainer &rootDeviceIndices);
     void freeSVMData(SvmAllocationData *svmData);
 
     MapBasedAllocationTracker SVMAllocs;
@@ -222,6 +276,10 @@ class SVMAllocsManager {
     std::mutex mtxForIndirectAccess;
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
+    SvmAllocationCache usmHostAllocationsCache;
+    SvmAllocationCache usmSharedAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    bool usmHostAllocationsCacheEnabled = false;
+    bool usmSharedAllocationsCacheEnabled = false;
 };
 } // namespace NEO
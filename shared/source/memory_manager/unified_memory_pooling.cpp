@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_pooling.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+namespace NEO {
+
+UsmMemAllocPool::~UsmMemAllocPool() {
+    cleanup();
+}
+
+bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize) {
+    UNRECOVERABLE_IF(isInitialized());
+    if (memoryProperties.allocationFlags.hostptr != 0u) {
+        return false;
+    }
+
+    void *poolPtr = nullptr;
+    if (memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
+        poolPtr = svmMemoryManager->createHostUnifiedMemoryAllocation(poolSize, memoryProperties);
+    } else if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
+        poolPtr = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
+    }
+    if (nullptr == poolPtr) {
+        return false;
+    }
+
+    this->svmMemoryManager = svmMemoryManager;
+    this->pooledAllocData = svmMemoryManager->getSVMAlloc(poolPtr);
+    this->pool = poolPtr;
+    this->poolEnd = ptrOffset(poolPtr, poolSize);
+    this->poolSize = poolSize;
+    this->poolMemoryType = memoryProperties.memoryType;
+    this->device = memoryProperties.device;
+    this->poolAllocationFlags = memoryProperties.allocationFlags;
+    this->chunkAllocator = std::make_unique<HeapAllocator>(castToUint64(poolPtr), poolSize, chunkAlignment);
+    return true;
+}
+
+bool UsmMemAllocPool::isInitialized() const {
+    return nullptr != pool;
+}
+
+void UsmMemAllocPool::cleanup() {
+    if (isInitialized()) {
+        svmMemoryManager->freeSVMAlloc(pool, true);
+        allocations.clear();
+        deferredChunks.clear();
+        chunkAllocator.reset();
+        svmMemoryManager = nullptr;
+        pooledAllocData = nullptr;
+        pool = nullptr;
+        poolEnd = nullptr;
+        poolSize = 0u;
+    }
+}
+
+bool UsmMemAllocPool::alignmentIsAllowed(size_t alignment) {
+    return alignment <= maxAlignment && (alignment == 0u || Math::isPow2(alignment));
+}
+
+bool UsmMemAllocPool::canBePooled(size_t size, size_t alignment, const UnifiedMemoryProperties &memoryProperties) const {
+    return isInitialized() &&
+           size > 0u &&
+           size <= allocationThreshold &&
+           alignmentIsAllowed(alignment) &&
+           memoryProperties.memoryType == poolMemoryType &&
+           memoryProperties.device == device &&
+           memoryProperties.allocationFlags.hostptr == 0u &&
+           memoryProperties.allocationFlags.allFlags == poolAllocationFlags.allFlags &&
+           memoryProperties.allocationFlags.allAllocFlags == poolAllocationFlags.allAllocFlags;
+}
+
+void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, size_t alignment, const UnifiedMemoryProperties &memoryProperties) {
+    if (!canBePooled(requestedSize, alignment, memoryProperties)) {
+        return nullptr;
+    }
+
+    size_t actualSize = requestedSize;
+    auto address = chunkAllocator->allocateWithCustomAlignment(actualSize, std::max(alignment, chunkAlignment));
+    if (0u == address) {
+        freeSVMAllocDeferImpl();
+        actualSize = requestedSize;
+        address = chunkAllocator->allocateWithCustomAlignment(actualSize, std::max(alignment, chunkAlignment));
+        if (0u == address) {
+            return nullptr;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    allocations.insert({address, AllocationInfo{address, actualSize, requestedSize}});
+    return reinterpret_cast<void *>(address);
+}
+
+bool UsmMemAllocPool::isInPool(const void *ptr) const {
+    return ptr >= pool && ptr < poolEnd;
+}
+
+bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
+    AllocationInfo allocationInfo;
+    if (!detachAllocation(ptr, allocationInfo)) {
+        return false;
+    }
+
+    if (blocking) {
+        for (auto &gpuAllocation : pooledAllocData->gpuAllocations.getGraphicsAllocations()) {
+            if (gpuAllocation) {
+                svmMemoryManager->getMemoryManager()->waitForEnginesCompletion(*gpuAllocation);
+            }
+        }
+    }
+    chunkAllocator->free(allocationInfo.address, allocationInfo.size);
+    if (blocking) {
+        freeSVMAllocDeferImpl();
+    }
+    return true;
+}
+
+bool UsmMemAllocPool::freeSVMAllocDefer(const void *ptr) {
+    AllocationInfo allocationInfo;
+    if (!detachAllocation(ptr, allocationInfo)) {
+        return false;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        deferredChunks.push_back(allocationInfo);
+    }
+    freeSVMAllocDeferImpl();
+    return true;
+}
+
+void UsmMemAllocPool::freeSVMAllocDeferImpl() {
+    std::vector<AllocationInfo> chunksToFree;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (deferredChunks.empty() || isPoolInUse()) {
+            return;
+        }
+        chunksToFree.swap(deferredChunks);
+    }
+    for (auto &chunk : chunksToFree) {
+        chunkAllocator->free(chunk.address, chunk.size);
+    }
+}
+
+size_t UsmMemAllocPool::getNumDeferredChunks() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return deferredChunks.size();
+}
+
+bool UsmMemAllocPool::detachAllocation(const void *ptr, AllocationInfo &allocationInfo) {
+    if (!isInPool(ptr)) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocation = allocations.find(castToUint64(ptr));
+    if (allocation == allocations.end()) {
+        return false;
+    }
+    allocationInfo = allocation->second;
+    allocations.erase(allocation);
+    return true;
+}
+
+bool UsmMemAllocPool::isPoolInUse() const {
+    auto memoryManager = svmMemoryManager->getMemoryManager();
+    if (pooledAllocData->cpuAllocation && memoryManager->allocInUse(*pooledAllocData->cpuAllocation)) {
+        return true;
+    }
+    for (auto &gpuAllocation : pooledAllocData->gpuAllocations.getGraphicsAllocations()) {
+        if (gpuAllocation && memoryManager->allocInUse(*gpuAllocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t UsmMemAllocPool::getPooledAllocationSize(const void *ptr) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocation = findAllocation(ptr);
+    if (allocation == allocations.end()) {
+        return 0u;
+    }
+    return allocation->second.requestedSize;
+}
+
+void *UsmMemAllocPool::getPooledAllocationBasePtr(const void *ptr) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocation = findAllocation(ptr);
+    if (allocation == allocations.end()) {
+        return nullptr;
+    }
+    return reinterpret_cast<void *>(allocation->second.address);
+}
+
+uint64_t UsmMemAllocPool::getUsedSize() const {
+    return isInitialized() ? chunkAllocator->getUsedSize() : 0u;
+}
+
+std::map<uint64_t, UsmMemAllocPool::AllocationInfo>::iterator UsmMemAllocPool::findAllocation(const void *ptr) {
+    if (!isInPool(ptr)) {
+        return allocations.end();
+    }
+    auto address = castToUint64(ptr);
+    auto allocation = allocations.upper_bound(address);
+    if (allocation == allocations.begin()) {
+        return allocations.end();
+    }
+    --allocation;
+    if (address >= allocation->second.address + allocation->second.requestedSize) {
+        return allocations.end();
+    }
+    return allocation;
+}
+
+} // namespace NEO
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Sub-allocates small USM allocations out of a single backing USM allocation.
+// Pointers returned by the pool are interior pointers of the backing allocation,
+// so SVMAllocsManager::getSVMAlloc resolves them to the backing allocation data.
+class UsmMemAllocPool : NonCopyableOrMovableClass {
+  public:
+    using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
+    struct AllocationInfo {
+        uint64_t address;
+        size_t size;
+        size_t requestedSize;
+    };
+    static constexpr size_t allocationThreshold = MemoryConstants::megaByte;
+    static constexpr size_t chunkAlignment = MemoryConstants::cacheLineSize;
+    static constexpr size_t maxAlignment = MemoryConstants::pageSize64k;
+
+    UsmMemAllocPool() = default;
+    ~UsmMemAllocPool();
+
+    bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize);
+    bool isInitialized() const;
+    void cleanup();
+
+    static bool alignmentIsAllowed(size_t alignment);
+    bool canBePooled(size_t size, size_t alignment, const UnifiedMemoryProperties &memoryProperties) const;
+    void *createUnifiedMemoryAllocation(size_t size, size_t alignment, const UnifiedMemoryProperties &memoryProperties);
+    bool isInPool(const void *ptr) const;
+    bool freeSVMAlloc(const void *ptr, bool blocking);
+    bool freeSVMAllocDefer(const void *ptr);
+    void freeSVMAllocDeferImpl();
+    size_t getPooledAllocationSize(const void *ptr);
+    void *getPooledAllocationBasePtr(const void *ptr);
+    void *getPoolAddress() const { return pool; }
+    size_t getPoolSize() const { return poolSize; }
+    uint64_t getUsedSize() const;
+    size_t getNumDeferredChunks();
+
+  protected:
+    std::map<uint64_t, AllocationInfo>::iterator findAllocation(const void *ptr);
+    bool detachAllocation(const void *ptr, AllocationInfo &allocationInfo);
+    bool isPoolInUse() const;
+
+    SVMAllocsManager *svmMemoryManager = nullptr;
+    SvmAllocationData *pooledAllocData = nullptr;
+    void *pool = nullptr;
+    void *poolEnd = nullptr;
+    size_t poolSize = 0u;
+    InternalMemoryType poolMemoryType = InternalMemoryType::NOT_SPECIFIED;
+    Device *device = nullptr;
+    MemoryProperties poolAllocationFlags;
+    std::unique_ptr<HeapAllocator> chunkAllocator;
+    std::map<uint64_t, AllocationInfo> allocations;
+    std::vector<AllocationInfo> deferredChunks;
+    std::mutex mtx;
+};
+
+} // namespace NEO
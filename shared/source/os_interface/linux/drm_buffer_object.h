@@ -214,6 +214,13 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
     std::vector<std::array<bool, EngineLimits::maxHandleCount>> bindInfo;
 
+    // Node of DrmGemCloseWorker queues, BO is linked only while it has no other pending closes
+    struct GemCloseNode {
+        BufferObject *next = nullptr;
+        std::atomic<uint32_t> pendingCloses{0};
+    };
+    GemCloseNode &getGemCloseNode() { return gemCloseNode; }
+
   protected:
     MOCKABLE_VIRTUAL MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded);
 
@@ -249,6 +256,8 @@ class BufferObject {
     size_t colourChunk = 0;
     std::vector<uint64_t> bindAddresses;
 
+    GemCloseNode gemCloseNode;
+
   private:
     uint64_t gpuAddress = 0llu;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,51 +7,79 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
-#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
-#include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
-#include <atomic>
-#include <iostream>
-#include <queue>
+#include <algorithm>
 
 namespace NEO {
 
-DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
-    thread = Thread::create(worker, reinterpret_cast<void *>(this));
+DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : DrmGemCloseWorker(memoryManager, defaultThreadsCount) {
 }
 
-void DrmGemCloseWorker::closeThread() {
-    if (thread) {
-        while (!workerDone.load()) {
-            condition.notify_all();
-        }
+DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager, uint32_t threadsCount) : memoryManager(memoryManager) {
+    if (DebugManager.flags.GemCloseWorkerThreadsCount.get() != -1) {
+        threadsCount = static_cast<uint32_t>(DebugManager.flags.GemCloseWorkerThreadsCount.get());
+    }
+    threadsCount = std::clamp(threadsCount, 1u, maxThreadsCount);
 
-        thread->join();
-        thread.reset();
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        auto workQueue = std::make_unique<WorkQueue>();
+        workQueue->worker = this;
+        workQueues.push_back(std::move(workQueue));
+    }
+    for (auto &workQueue : workQueues) {
+        workQueue->thread = Thread::create(worker, reinterpret_cast<void *>(workQueue.get()));
+    }
+}
+
+void DrmGemCloseWorker::closeThreads() {
+    for (auto &workQueue : workQueues) {
+        if (workQueue->thread) {
+            workQueue->thread->join();
+            workQueue->thread.reset();
+        }
     }
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
-    active = false;
-    closeThread();
+    close(true);
+    drainOnCallingThread();
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    pushedCount++;
+
+    auto &node = bo->getGemCloseNode();
+    if (node.pendingCloses.fetch_add(1u, std::memory_order_acq_rel) != 0u) {
+        // already queued, consumer closes it once per pending push
+        return;
+    }
+
+    auto &workQueue = *workQueues[nextQueue.fetch_add(1u, std::memory_order_relaxed) % workQueues.size()];
+    auto head = workQueue.head.load(std::memory_order_relaxed);
+    do {
+        node.next = head;
+    } while (!workQueue.head.compare_exchange_weak(head, bo, std::memory_order_release, std::memory_order_relaxed));
+
+    if (head == nullptr) {
+        // queue was empty, worker may be waiting - take the mutex so the wakeup is not lost
+        std::lock_guard<std::mutex> lock(workQueue.mtx);
+        workQueue.condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
     active = false;
-    condition.notify_all();
+    for (auto &workQueue : workQueues) {
+        std::lock_guard<std::mutex> lock(workQueue->mtx);
+        workQueue->condition.notify_all();
+    }
     if (blocking) {
-        closeThread();
+        closeThreads();
     }
 }
 
@@ -59,47 +87,78 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+bool DrmGemCloseWorker::tryDrain() {
+    for (auto &workQueue : workQueues) {
+        if (workQueue->head.load(std::memory_order_acquire) != nullptr) {
+            std::lock_guard<std::mutex> lock(workQueue->mtx);
+            workQueue->condition.notify_one();
+        }
+    }
+    return isEmpty();
+}
+
+void DrmGemCloseWorker::drainOnCallingThread() {
+    for (auto &workQueue : workQueues) {
+        while (processQueue(*workQueue)) {
+        }
+    }
+}
+
+GemCloseWorkerProgress DrmGemCloseWorker::getProgress() const {
+    GemCloseWorkerProgress progress;
+    progress.closedCount = closedCount.load();
+    progress.pushedCount = pushedCount.load();
+    return progress;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
+    closedCount++;
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+bool DrmGemCloseWorker::processQueue(WorkQueue &workQueue) {
+    auto bo = workQueue.head.exchange(nullptr, std::memory_order_acquire);
+    if (bo == nullptr) {
+        return false;
+    }
+
+    BufferObject *batch = nullptr;
+    while (bo) {
+        auto &node = bo->getGemCloseNode();
+        auto next = node.next;
+        node.next = batch;
+        batch = bo;
+        bo = next;
     }
+
+    while (batch) {
+        auto &node = batch->getGemCloseNode();
+        auto next = node.next;
+        // after this point BO may be pushed again and relinked, do not touch its node
+        auto pendingCloses = node.pendingCloses.exchange(0u, std::memory_order_acq_rel);
+        for (uint32_t i = 0; i < pendingCloses; i++) {
+            close(batch);
+        }
+        batch = next;
+    }
+    return true;
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+    auto &workQueue = *reinterpret_cast<WorkQueue *>(arg);
+    DrmGemCloseWorker *self = workQueue.worker;
 
     while (self->active) {
-        lock.lock();
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
-        }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        if (!self->processQueue(workQueue)) {
+            std::unique_lock<std::mutex> lock(workQueue.mtx);
+            workQueue.condition.wait(lock, [&]() { return workQueue.head.load() != nullptr || !self->active; });
         }
-
-        lock.unlock();
-        self->processQueue(localQueue);
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
-
-    lock.unlock();
-    self->workerDone.store(true);
+    while (self->processQueue(workQueue)) {
+    }
     return nullptr;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,9 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,9 +23,18 @@ enum class gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct GemCloseWorkerProgress {
+    uint64_t pushedCount = 0u;
+    uint64_t closedCount = 0u;
+};
+
 class DrmGemCloseWorker {
   public:
+    static constexpr uint32_t defaultThreadsCount = 1u;
+    static constexpr uint32_t maxThreadsCount = 16u;
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
+    DrmGemCloseWorker(DrmMemoryManager &memoryManager, uint32_t threadsCount);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
     DrmGemCloseWorker(const DrmGemCloseWorker &) = delete;
@@ -36,23 +44,34 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    // wakes workers with pending closes and reports whether nothing is left, never closes on the calling thread
+    bool tryDrain();
+    GemCloseWorkerProgress getProgress() const;
+    uint32_t getThreadsCount() const { return static_cast<uint32_t>(workQueues.size()); }
 
   protected:
+    // Intrusive stack linked through BufferObject::GemCloseNode, producers push with a single CAS and consumers take the whole batch with one exchange.
+    struct alignas(64) WorkQueue {
+        std::atomic<BufferObject *> head{nullptr};
+        std::mutex mtx;
+        std::condition_variable condition;
+        std::unique_ptr<Thread> thread;
+        DrmGemCloseWorker *worker = nullptr;
+    };
+
     void close(BufferObject *workItem);
-    void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void closeThreads();
+    void drainOnCallingThread();
+    bool processQueue(WorkQueue &workQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
-    std::unique_ptr<Thread> thread;
-
-    std::queue<BufferObject *> queue;
+    std::vector<std::unique_ptr<WorkQueue>> workQueues;
+    std::atomic<uint32_t> nextQueue{0};
     std::atomic<uint32_t> workCount{0};
+    std::atomic<uint64_t> pushedCount{0};
+    std::atomic<uint64_t> closedCount{0};
 
     DrmMemoryManager &memoryManager;
-
-    std::mutex closeWorkerMutex;
-    std::condition_variable condition;
-    std::atomic<bool> workerDone{false};
 };
 } // namespace NEO
@@ -8,8 +8,11 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -20,8 +23,17 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    size_t migrationChunkSize = 0u;
+    if (DebugManager.flags.UsmSharedMigrationChunkSize.get() > 0 && isChunkedMigrationSupported()) {
+        migrationChunkSize = std::max(Math::nextPowerOfTwo(static_cast<size_t>(DebugManager.flags.UsmSharedMigrationChunkSize.get())), MemoryConstants::pageSize);
+        if (migrationChunkSize >= size) {
+            migrationChunkSize = 0u;
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    auto &pageFaultData = this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain})).first->second;
+    pageFaultData.migrationChunkSize = migrationChunkSize;
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -33,9 +45,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu || pageFaultData.migrationChunkSize != 0u) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
-        } else {
+        }
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -80,29 +93,58 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
+        size_t transferredSize = pageFaultData.cpuRanges.empty() ? pageFaultData.size : 0u;
+        for (auto &cpuRange : pageFaultData.cpuRanges) {
+            transferredSize += cpuRange.second;
+        }
+
+        statistics.transfersToGpu++;
+        statistics.bytesTransferredToGpu += transferredSize;
+        statistics.transferToGpuTimeNs += elapsedTime;
+        statistics.maxTransferToGpuTimeNs = std::max(statistics.maxTransferToGpuTimeNs, static_cast<uint64_t>(elapsedTime));
+
         if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), transferredSize, elapsedTime / 1e3);
         }
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        if (pageFaultData.cpuRanges.empty()) {
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        }
+        for (auto &cpuRange : pageFaultData.cpuRanges) {
+            this->protectCPUMemoryAccess(ptrOffset(ptr, cpuRange.first), cpuRange.second);
+        }
+        pageFaultData.cpuRanges.clear();
     }
     pageFaultData.domain = AllocationDomain::Gpu;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc != this->memoryData.begin()) {
+        --alloc;
+        auto allocPtr = alloc->first;
+        auto &pageFaultData = alloc->second;
+        if (ptr < ptrOffset(allocPtr, pageFaultData.size)) {
+            statistics.pageFaults++;
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
+            if (pageFaultData.migrationChunkSize != 0u) {
+                this->handleChunkedPageFault(ptr, allocPtr, pageFaultData);
+            } else {
+                gpuDomainHandler(this, allocPtr, pageFaultData);
+            }
             return true;
         }
     }
+    statistics.unhandledPageFaults++;
     return false;
 }
 
+PageFaultManager::PageFaultStatistics PageFaultManager::getStatistics() {
+    std::unique_lock<SpinLock> lock{mtx};
+    return statistics;
+}
+
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
     this->gpuDomainHandler = gpuHandlerFuncPtr;
 }
@@ -127,6 +169,11 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
+        statistics.transfersToCpu++;
+        statistics.bytesTransferredToCpu += pageFaultData.size;
+        statistics.transferToCpuTimeNs += elapsedTime;
+        statistics.maxTransferToCpuTimeNs = std::max(statistics.maxTransferToCpuTimeNs, static_cast<uint64_t>(elapsedTime));
+
         if (DebugManager.flags.PrintUmdSharedMigration.get()) {
             printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
         }
@@ -135,6 +182,77 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::Cpu;
 }
 
+void PageFaultManager::handleChunkedPageFault(void *faultPtr, void *allocPtr, PageFaultData &pageFaultData) {
+    if (pageFaultData.domain == AllocationDomain::None) {
+        pageFaultData.cpuRanges[0u] = pageFaultData.size;
+        pageFaultData.domain = AllocationDomain::Cpu;
+        this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+        return;
+    }
+
+    auto faultOffset = ptrDiff(faultPtr, allocPtr);
+    auto migrationSize = getChunkedMigrationSize(faultOffset, pageFaultData);
+    if (migrationSize == 0u) {
+        return;
+    }
+    auto migrationOffset = alignDown(faultOffset, pageFaultData.migrationChunkSize);
+    auto migrationPtr = ptrOffset(allocPtr, migrationOffset);
+
+    if (this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory) {
+        this->allowCPUMemoryAccess(migrationPtr, migrationSize);
+        this->migrateChunksToCpuDomain(allocPtr, migrationOffset, migrationSize, pageFaultData);
+    } else {
+        this->migrateChunksToCpuDomain(allocPtr, migrationOffset, migrationSize, pageFaultData);
+        this->allowCPUMemoryAccess(migrationPtr, migrationSize);
+    }
+}
+
+size_t PageFaultManager::getChunkedMigrationSize(size_t faultOffset, const PageFaultData &pageFaultData) {
+    auto nextCpuRange = pageFaultData.cpuRanges.upper_bound(faultOffset);
+    if (nextCpuRange != pageFaultData.cpuRanges.begin()) {
+        auto cpuRange = std::prev(nextCpuRange);
+        if (faultOffset < cpuRange->first + cpuRange->second) {
+            return 0u;
+        }
+    }
+
+    size_t prefetchChunks = 1u;
+    if (DebugManager.flags.UsmSharedMigrationPrefetchChunks.get() != -1) {
+        prefetchChunks = static_cast<size_t>(DebugManager.flags.UsmSharedMigrationPrefetchChunks.get());
+    }
+
+    auto migrationStart = alignDown(faultOffset, pageFaultData.migrationChunkSize);
+    auto migrationEnd = nextCpuRange != pageFaultData.cpuRanges.end() ? nextCpuRange->first : pageFaultData.size;
+    migrationEnd = std::min(migrationEnd, migrationStart + (prefetchChunks + 1) * pageFaultData.migrationChunkSize);
+    return migrationEnd - migrationStart;
+}
+
+inline void PageFaultManager::migrateChunksToCpuDomain(void *ptr, size_t offset, size_t size, PageFaultData &pageFaultData) {
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+    }
+
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+
+    start = std::chrono::steady_clock::now();
+    this->transferToCpu(ptrOffset(ptr, offset), size, pageFaultData.cmdQ);
+    end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    statistics.transfersToCpu++;
+    statistics.bytesTransferredToCpu += size;
+    statistics.transferToCpuTimeNs += elapsedTime;
+    statistics.maxTransferToCpuTimeNs = std::max(statistics.maxTransferToCpuTimeNs, static_cast<uint64_t>(elapsedTime));
+
+    if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+        printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptrOffset(ptr, offset)), size, elapsedTime / 1e3);
+    }
+
+    pageFaultData.cpuRanges[offset] = size;
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
+
 void PageFaultManager::selectGpuDomainHandler() {
     if (DebugManager.flags.SetCommandStreamReceiver.get() > CommandStreamReceiverType::CSR_HW || DebugManager.flags.NEO_CAL_ENABLED.get()) {
         this->gpuDomainHandler = &PageFaultManager::unprotectAndTransferMemory;
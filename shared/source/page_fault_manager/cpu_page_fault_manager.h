@@ -10,8 +10,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <cstdint>
+#include <map>
 #include <memory>
-#include <unordered_map>
 
 namespace NEO {
 struct MemoryProperties;
@@ -41,8 +42,26 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t migrationChunkSize = 0u;
+        // offset -> size of ranges migrated to CPU, used only when migrationChunkSize is set
+        std::map<size_t, size_t> cpuRanges;
     };
 
+    struct PageFaultStatistics {
+        uint64_t pageFaults = 0u;
+        uint64_t unhandledPageFaults = 0u;
+        uint64_t transfersToCpu = 0u;
+        uint64_t transfersToGpu = 0u;
+        uint64_t bytesTransferredToCpu = 0u;
+        uint64_t bytesTransferredToGpu = 0u;
+        uint64_t transferToCpuTimeNs = 0u;
+        uint64_t transferToGpuTimeNs = 0u;
+        uint64_t maxTransferToCpuTimeNs = 0u;
+        uint64_t maxTransferToGpuTimeNs = 0u;
+    };
+
+    PageFaultStatistics getStatistics();
+
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
 
     void setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr);
@@ -50,6 +69,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    static bool isChunkedMigrationSupported();
 
   protected:
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
@@ -61,12 +81,16 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     static void transferAndUnprotectMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void unprotectAndTransferMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
+    void handleChunkedPageFault(void *faultPtr, void *allocPtr, PageFaultData &pageFaultData);
+    size_t getChunkedMigrationSize(size_t faultOffset, const PageFaultData &pageFaultData);
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void migrateChunksToCpuDomain(void *ptr, size_t offset, size_t size, PageFaultData &pageFaultData);
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData;
+    PageFaultStatistics statistics;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,8 @@ struct CpuInfo {
     static const uint64_t featureAvX2 = 0x000800000ULL;
     static const uint64_t featureNeon = 0x001000000ULL;
     static const uint64_t featureClflush = 0x2000000000ULL;
+    static const uint64_t featureWaitpkg = 0x4000000000ULL;
+    static const uint64_t featureAvX512 = 0x8000000000ULL;
 
     CpuInfo() : features(featureNone) {
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,18 @@
 #include <sse2neon.h>
 #else
 #include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_WIN32)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define WAITPKG_TARGET __attribute__((target("waitpkg")))
+#else
+#define WAITPKG_TARGET
 #endif
 
 namespace NEO {
@@ -28,5 +40,30 @@ void pause() {
     _mm_pause();
 }
 
+#if defined(__ARM_ARCH)
+void umonitor(void const volatile *ptr) {
+}
+
+uint8_t umwait(uint32_t control, uint64_t counter) {
+    return 0u;
+}
+
+uint64_t rdtsc() {
+    return 0u;
+}
+#else
+WAITPKG_TARGET void umonitor(void const volatile *ptr) {
+    _umonitor(const_cast<void *>(ptr));
+}
+
+WAITPKG_TARGET uint8_t umwait(uint32_t control, uint64_t counter) {
+    return _umwait(control, counter);
+}
+
+uint64_t rdtsc() {
+    return __rdtsc();
+}
+#endif
+
 } // namespace CpuIntrinsics
 } // namespace NEO
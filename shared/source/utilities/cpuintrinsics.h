@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -16,5 +18,11 @@ void clFlush(void const *ptr);
 
 void pause();
 
+void umonitor(void const volatile *ptr);
+
+uint8_t umwait(uint32_t control, uint64_t counter);
+
+uint64_t rdtsc();
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/logger.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
@@ -30,7 +32,7 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
-    std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+    HeapFreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
     for (;;) {
@@ -90,7 +92,7 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
     if (ptr == pRightBound) {
         pRightBound = ptr + size;
         mergeLastFreedSmall();
-    } else if (ptr == pLeftBound - size) {
+    } else if (ptr + size == pLeftBound) {
         pLeftBound = ptr;
         mergeLastFreedBig();
     } else if (ptr < pLeftBound) {
@@ -107,87 +109,287 @@ double HeapAllocator::getUsage() const {
     return static_cast<double>(size - availableSize) / size;
 }
 
-uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
-    size_t elements = freedChunks.size();
-    size_t bestFitIndex = -1;
-    size_t bestFitSize = 0;
-    sizeOfFreedChunk = 0;
+HeapFragmentationStatistics HeapAllocator::getFragmentationStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    HeapFragmentationStatistics statistics;
+    statistics.freedChunksCount = freedChunksSmall.size() + freedChunksBig.size();
+    statistics.freedChunksSize = freedChunksSmall.getTotalSize() + freedChunksBig.getTotalSize();
+    statistics.largestFreeBlockSize = std::max({pRightBound - pLeftBound,
+                                                static_cast<uint64_t>(freedChunksSmall.getLargestChunkSize()),
+                                                static_cast<uint64_t>(freedChunksBig.getLargestChunkSize())});
+    statistics.freeSize = availableSize;
+    if (availableSize > 0u) {
+        statistics.fragmentation = 1.0 - static_cast<double>(statistics.largestFreeBlockSize) / availableSize;
+    }
+    return statistics;
+}
 
-    for (size_t i = 0; i < elements; i++) {
-        const bool chunkAligned = isAligned(freedChunks[i].ptr, requiredAlignment);
-        if (!chunkAligned) {
-            continue;
+void HeapAllocator::defragment() {
+    mergeLastFreedSmall();
+    mergeLastFreedBig();
+    DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
+}
+
+void HeapFreedChunks::store(uint64_t ptr, size_t size) {
+    if (indexed) {
+        storeIndexed(ptr, size);
+    } else {
+        storeLinear(ptr, size);
+    }
+    updateIndexing();
+}
+
+uint64_t HeapFreedChunks::get(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk) {
+    auto ptr = indexed ? getIndexed(size, requiredAlignment, sizeOfFreedChunk) : getLinear(size, requiredAlignment, sizeOfFreedChunk);
+    updateIndexing();
+    return ptr;
+}
+
+bool HeapFreedChunks::takeChunkStartingAt(uint64_t ptr, size_t &size) {
+    if (!indexed) {
+        auto chunk = std::lower_bound(chunks.begin(), chunks.end(), HeapChunk(ptr, 0u));
+        if (chunk == chunks.end() || chunk->ptr != ptr) {
+            return false;
         }
+        size = chunk->size;
+        totalSize -= chunk->size;
+        chunks.erase(chunk);
+        return true;
+    }
 
-        if (freedChunks[i].size == size) {
-            auto ptr = freedChunks[i].ptr;
-            freedChunks.erase(freedChunks.begin() + i);
-            return ptr;
+    auto chunk = chunksByAddress.find(ptr);
+    if (chunk == chunksByAddress.end()) {
+        return false;
+    }
+    size = chunk->second;
+    erase(chunk);
+    updateIndexing();
+    return true;
+}
+
+bool HeapFreedChunks::takeChunkEndingAt(uint64_t end, uint64_t &ptr) {
+    if (!indexed) {
+        auto chunk = std::lower_bound(chunks.begin(), chunks.end(), HeapChunk(end, 0u));
+        if (chunk == chunks.begin()) {
+            return false;
+        }
+        --chunk;
+        if (chunk->ptr + chunk->size != end) {
+            return false;
         }
+        ptr = chunk->ptr;
+        totalSize -= chunk->size;
+        chunks.erase(chunk);
+        return true;
+    }
+
+    auto chunk = chunksByAddress.lower_bound(end);
+    if (chunk == chunksByAddress.begin()) {
+        return false;
+    }
+    --chunk;
+    if (chunk->first + chunk->second != end) {
+        return false;
+    }
+    ptr = chunk->first;
+    erase(chunk);
+    updateIndexing();
+    return true;
+}
+
+size_t HeapFreedChunks::getLargestChunkSize() const {
+    if (indexed) {
+        return chunksBySize.empty() ? 0u : chunksBySize.rbegin()->first;
+    }
+    size_t largestChunkSize = 0u;
+    for (auto &chunk : chunks) {
+        largestChunkSize = std::max(largestChunkSize, chunk.size);
+    }
+    return largestChunkSize;
+}
+
+std::vector<HeapChunk> HeapFreedChunks::getChunks() const {
+    if (!indexed) {
+        return chunks;
+    }
+    std::vector<HeapChunk> addressOrderedChunks;
+    addressOrderedChunks.reserve(chunksByAddress.size());
+    for (auto &chunk : chunksByAddress) {
+        addressOrderedChunks.emplace_back(chunk.first, chunk.second);
+    }
+    return addressOrderedChunks;
+}
+
+void HeapFreedChunks::storeLinear(uint64_t ptr, size_t size) {
+    uint64_t start = ptr;
+    uint64_t end = ptr + size;
+
+    auto first = std::lower_bound(chunks.begin(), chunks.end(), HeapChunk(ptr, 0u));
+    if (first != chunks.begin() && std::prev(first)->ptr + std::prev(first)->size >= start) {
+        --first;
+        start = first->ptr;
+    }
+    auto last = first;
+    while (last != chunks.end() && last->ptr <= end) {
+        end = std::max(end, last->ptr + last->size);
+        totalSize -= last->size;
+        ++last;
+    }
+    totalSize += end - start;
 
-        if (freedChunks[i].size > size) {
-            if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                bestFitIndex = i;
-                bestFitSize = freedChunks[i].size;
+    if (first == last) {
+        chunks.emplace(first, start, static_cast<size_t>(end - start));
+    } else {
+        first->ptr = start;
+        first->size = static_cast<size_t>(end - start);
+        chunks.erase(first + 1, last);
+    }
+}
+
+// Same choice as getIndexed: smallest usable chunk, lowest address among equally sized ones.
+uint64_t HeapFreedChunks::getLinear(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk) {
+    sizeOfFreedChunk = 0;
+
+    auto bestFit = chunks.end();
+    for (auto chunk = chunks.begin(); chunk != chunks.end(); ++chunk) {
+        if (chunk->size < size || !isAligned(chunk->ptr, requiredAlignment)) {
+            continue;
+        }
+        if (chunk->size >= (size << 1) && !isAligned(chunk->ptr + chunk->size - size, requiredAlignment)) {
+            continue;
+        }
+        if (bestFit == chunks.end() || chunk->size < bestFit->size) {
+            bestFit = chunk;
+            if (chunk->size == size) {
+                break;
             }
         }
     }
+    if (bestFit == chunks.end()) {
+        return 0llu;
+    }
 
-    if (bestFitSize != 0) {
-        if (bestFitSize < (size << 1)) {
-            auto ptr = freedChunks[bestFitIndex].ptr;
-            sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-            freedChunks.erase(freedChunks.begin() + bestFitIndex);
-            return ptr;
-        } else {
-            size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+    if (bestFit->size < (size << 1)) {
+        if (bestFit->size != size) {
+            sizeOfFreedChunk = bestFit->size;
+        }
+        auto ptr = bestFit->ptr;
+        totalSize -= bestFit->size;
+        chunks.erase(bestFit);
+        return ptr;
+    }
 
-            DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+    bestFit->size -= size;
+    totalSize -= size;
+    return bestFit->ptr + bestFit->size;
+}
 
-            auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-            freedChunks[bestFitIndex].size = sizeDelta;
+void HeapFreedChunks::storeIndexed(uint64_t ptr, size_t size) {
+    uint64_t start = ptr;
+    uint64_t end = ptr + size;
+    auto merged = chunksByAddress.end();
 
-            if (!isAligned(ptr, requiredAlignment)) {
-                return 0llu;
-            }
-            return ptr;
+    auto next = chunksByAddress.lower_bound(ptr);
+    if (next != chunksByAddress.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second >= start) {
+            start = previous->first;
+            end = std::max(end, previous->first + previous->second);
+            merged = previous;
         }
     }
-    return 0llu;
+    while (next != chunksByAddress.end() && next->first <= end) {
+        end = std::max(end, next->first + next->second);
+        if (merged == chunksByAddress.end()) {
+            merged = next++;
+        } else {
+            erase(next++);
+        }
+    }
+
+    if (merged == chunksByAddress.end()) {
+        insert(start, static_cast<size_t>(end - start));
+    } else {
+        replace(merged, start, static_cast<size_t>(end - start));
+    }
 }
 
-void HeapAllocator::defragment() {
+uint64_t HeapFreedChunks::getIndexed(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk) {
+    sizeOfFreedChunk = 0;
+
+    for (auto candidate = chunksBySize.lower_bound({size, 0u}); candidate != chunksBySize.end(); ++candidate) {
+        const size_t chunkSize = candidate->first;
+        const uint64_t chunkPtr = candidate->second;
+        if (!isAligned(chunkPtr, requiredAlignment)) {
+            continue;
+        }
 
-    if (freedChunksSmall.size() > 1) {
-        std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-        size_t maxSize = freedChunksSmall.size();
-        for (size_t i = maxSize - 1; i > 0; --i) {
-            auto ptr = freedChunksSmall[i].ptr;
-            size_t chunkSize = freedChunksSmall[i].size;
-
-            if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                freedChunksSmall[i - 1].ptr = ptr;
-                freedChunksSmall[i - 1].size += chunkSize;
-                freedChunksSmall.erase(freedChunksSmall.begin() + i);
+        if (chunkSize < (size << 1)) {
+            if (chunkSize != size) {
+                sizeOfFreedChunk = chunkSize;
             }
+            erase(chunksByAddress.find(chunkPtr));
+            return chunkPtr;
+        }
+
+        size_t sizeDelta = chunkSize - size;
+        auto ptr = chunkPtr + sizeDelta;
+        if (!isAligned(ptr, requiredAlignment)) {
+            continue;
         }
+        replace(chunksByAddress.find(chunkPtr), chunkPtr, sizeDelta);
+        return ptr;
     }
-    mergeLastFreedSmall();
-    if (freedChunksBig.size() > 1) {
-        std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-        size_t maxSize = freedChunksBig.size();
-        for (size_t i = maxSize - 1; i > 0; --i) {
-            auto ptr = freedChunksBig[i].ptr;
-            size_t chunkSize = freedChunksBig[i].size;
-            if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                freedChunksBig[i - 1].size += chunkSize;
-                freedChunksBig.erase(freedChunksBig.begin() + i);
-            }
+    return 0llu;
+}
+
+// Tree lookups only pay off for long lists, switching back at half the threshold avoids
+// rebuilding the indexes when the chunk count oscillates around it.
+void HeapFreedChunks::updateIndexing() {
+    if (!indexed && chunks.size() > indexThreshold) {
+        for (auto &chunk : chunks) {
+            chunksByAddress.emplace_hint(chunksByAddress.end(), chunk.ptr, chunk.size);
+            chunksBySize.emplace(chunk.size, chunk.ptr);
+        }
+        chunks.clear();
+        indexed = true;
+    } else if (indexed && chunksByAddress.size() < indexThreshold / 2) {
+        for (auto &chunk : chunksByAddress) {
+            chunks.emplace_back(chunk.first, chunk.second);
         }
+        chunksByAddress.clear();
+        chunksBySize.clear();
+        indexed = false;
     }
-    mergeLastFreedBig();
-    DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
+}
+
+void HeapFreedChunks::insert(uint64_t ptr, size_t size) {
+    chunksByAddress.emplace(ptr, size);
+    chunksBySize.emplace(size, ptr);
+    totalSize += size;
+}
+
+// Reuses tree nodes of an existing chunk, saving allocations when chunks are merged or split.
+void HeapFreedChunks::replace(std::map<uint64_t, size_t>::iterator chunk, uint64_t ptr, size_t size) {
+    auto sizeNode = chunksBySize.extract({chunk->second, chunk->first});
+    sizeNode.value() = {size, ptr};
+    chunksBySize.insert(std::move(sizeNode));
+    totalSize = totalSize - chunk->second + size;
+
+    if (chunk->first == ptr) {
+        chunk->second = size;
+    } else {
+        auto addressNode = chunksByAddress.extract(chunk);
+        addressNode.key() = ptr;
+        addressNode.mapped() = size;
+        chunksByAddress.insert(std::move(addressNode));
+    }
+}
+
+void HeapFreedChunks::erase(std::map<uint64_t, size_t>::iterator chunk) {
+    chunksBySize.erase({chunk->second, chunk->first});
+    totalSize -= chunk->second;
+    chunksByAddress.erase(chunk);
 }
 
 } // namespace NEO
@@ -10,7 +10,9 @@
 #include "shared/source/helpers/constants.h"
 
 #include <cstdint>
+#include <map>
 #include <mutex>
+#include <set>
 #include <vector>
 
 namespace NEO {
@@ -23,6 +25,51 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+// Freed ranges kept in an address-ordered vector scanned linearly while there are few of them.
+// Past indexThreshold they are indexed by address for coalescing with both neighbours
+// and by (size, address) for best fit lookup.
+class HeapFreedChunks {
+  public:
+    static constexpr size_t indexThreshold = 64u;
+
+    void store(uint64_t ptr, size_t size);
+    uint64_t get(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk);
+    bool takeChunkStartingAt(uint64_t ptr, size_t &size);
+    bool takeChunkEndingAt(uint64_t end, uint64_t &ptr);
+
+    size_t size() const { return indexed ? chunksByAddress.size() : chunks.size(); }
+    bool empty() const { return size() == 0u; }
+    bool isIndexed() const { return indexed; }
+    size_t getLargestChunkSize() const;
+    uint64_t getTotalSize() const { return totalSize; }
+    std::vector<HeapChunk> getChunks() const;
+
+  protected:
+    void storeLinear(uint64_t ptr, size_t size);
+    uint64_t getLinear(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk);
+    void storeIndexed(uint64_t ptr, size_t size);
+    uint64_t getIndexed(size_t size, size_t requiredAlignment, size_t &sizeOfFreedChunk);
+    void updateIndexing();
+
+    void insert(uint64_t ptr, size_t size);
+    void replace(std::map<uint64_t, size_t>::iterator chunk, uint64_t ptr, size_t size);
+    void erase(std::map<uint64_t, size_t>::iterator chunk);
+
+    std::vector<HeapChunk> chunks;
+    std::map<uint64_t, size_t> chunksByAddress;
+    std::set<std::pair<size_t, uint64_t>> chunksBySize;
+    uint64_t totalSize = 0u;
+    bool indexed = false;
+};
+
+struct HeapFragmentationStatistics {
+    size_t freedChunksCount = 0u;
+    uint64_t freedChunksSize = 0u;
+    uint64_t largestFreeBlockSize = 0u;
+    uint64_t freeSize = 0u;
+    double fragmentation = 0.0;
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
@@ -34,8 +81,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -56,6 +101,8 @@ class HeapAllocator {
 
     double getUsage() const;
 
+    HeapFragmentationStatistics getFragmentationStatistics();
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -64,58 +111,29 @@ class HeapAllocator {
     size_t allocationAlignment;
     const size_t sizeThreshold;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    HeapFreedChunks freedChunksSmall;
+    HeapFreedChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
-
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-            if ((freedChunk.ptr + freedChunk.size) == (ptr + size)) {
-                if (ptr < freedChunk.ptr) {
-                    freedChunk.ptr = ptr;
-                    freedChunk.size = size;
-                    return;
-                }
-            }
-        }
+    uint64_t getFromFreedChunks(size_t size, HeapFreedChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
+        return freedChunks.get(size, requiredAlignment, sizeOfFreedChunk);
+    }
 
-        freedChunks.emplace_back(ptr, size);
+    void storeInFreedChunks(uint64_t ptr, size_t size, HeapFreedChunks &freedChunks) {
+        freedChunks.store(ptr, size);
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
+        size_t chunkSize = 0u;
+        if (freedChunksSmall.takeChunkStartingAt(pRightBound, chunkSize)) {
+            pRightBound += chunkSize;
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
+        uint64_t ptr = 0u;
+        if (freedChunksBig.takeChunkEndingAt(pLeftBound, ptr)) {
+            pLeftBound = ptr;
         }
     }
 
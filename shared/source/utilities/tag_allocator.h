@@ -13,8 +13,10 @@
 
 #include "metrics_library_api_1_0.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 #include <vector>
@@ -29,6 +31,9 @@ class TagAllocator;
 template <typename TagType>
 class TagNode;
 
+template <typename NodeType>
+class TagFreeList;
+
 class TagAllocatorBase;
 
 class TagNodeBase : public NonCopyableOrMovableClass {
@@ -94,8 +99,14 @@ class TagNodeBase : public NonCopyableOrMovableClass {
     bool doNotReleaseNodes = false;
     bool profilingCapable = true;
 
+    uint32_t freeListIndex = 0;
+    std::atomic<uint32_t> nextFreeListIndex{0};
+
     template <typename TagType>
     friend class TagAllocator;
+
+    template <typename NodeType>
+    friend class TagFreeList;
 };
 
 template <typename TagType>
@@ -136,6 +147,40 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
     MetricsLibraryApi::QueryHandle_1_0 &getQueryHandleRef() const override;
 };
 
+// Lock-free (Treiber) stack of free tag nodes.
+// Nodes are addressed by their index in the registered node pools, so the head word can carry an ABA counter next to the node index.
+template <typename NodeType>
+class TagFreeList : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t poolsPerSegment = 1024;
+    static constexpr size_t maxSegmentsCount = 1024;
+
+    explicit TagFreeList(size_t poolSize) : poolSize(poolSize) {}
+
+    // not thread safe against other addPool calls
+    void addPool(NodeType *nodes);
+
+    NodeType *removeFrontOne();
+    void pushFrontOne(NodeType &node);
+
+    bool peekIsEmpty() const { return getIndex(head.load(std::memory_order_acquire)) == 0; }
+    NodeType *peekHead() const { return getNode(getIndex(head.load(std::memory_order_acquire))); }
+    NodeType *peekNext(const NodeType &node) const { return getNode(node.nextFreeListIndex.load(std::memory_order_acquire)); }
+    bool peekContains(const NodeType &node) const;
+
+  protected:
+    static uint32_t getIndex(uint64_t headValue) { return static_cast<uint32_t>(headValue); }
+    static uint64_t makeHead(uint64_t previousHeadValue, uint32_t index) { return (((previousHeadValue >> 32) + 1) << 32) | index; }
+    NodeType *getNode(uint32_t index) const;
+    void pushFront(NodeType &first, NodeType &last);
+
+    std::array<std::atomic<NodeType **>, maxSegmentsCount> segments{};
+    std::vector<std::unique_ptr<NodeType *[]>> segmentsStorage;
+    std::atomic<uint64_t> head{0};
+    size_t poolSize;
+    size_t poolsCount = 0;
+};
+
 class TagAllocatorBase {
   public:
     virtual ~TagAllocatorBase() { cleanUpResources(); };
@@ -195,8 +240,8 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
+    TagFreeList<NodeType> freeTags;
+    std::atomic<size_t> usedTagsCount{0};
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
@@ -8,11 +8,85 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <limits>
+
 namespace NEO {
+template <typename NodeType>
+NodeType *TagFreeList<NodeType>::getNode(uint32_t index) const {
+    if (index == 0) {
+        return nullptr;
+    }
+    auto nodeId = index - 1;
+    auto poolId = nodeId / poolSize;
+    auto segment = segments[poolId / poolsPerSegment].load(std::memory_order_acquire);
+    return &segment[poolId % poolsPerSegment][nodeId % poolSize];
+}
+
+template <typename NodeType>
+void TagFreeList<NodeType>::addPool(NodeType *nodes) {
+    UNRECOVERABLE_IF(poolSize == 0);
+    UNRECOVERABLE_IF(poolsCount == poolsPerSegment * maxSegmentsCount);
+    UNRECOVERABLE_IF((poolsCount + 1) * poolSize >= std::numeric_limits<uint32_t>::max());
+
+    auto firstIndex = static_cast<uint32_t>(poolsCount * poolSize + 1);
+    for (size_t i = 0; i < poolSize; i++) {
+        nodes[i].freeListIndex = firstIndex + static_cast<uint32_t>(i);
+        nodes[i].nextFreeListIndex.store(nodes[i].freeListIndex + 1, std::memory_order_relaxed);
+    }
+
+    auto segmentId = poolsCount / poolsPerSegment;
+    if (segmentId == segmentsStorage.size()) {
+        segmentsStorage.push_back(std::make_unique<NodeType *[]>(poolsPerSegment));
+    }
+    auto segment = segmentsStorage[segmentId].get();
+    segment[poolsCount % poolsPerSegment] = nodes;
+    segments[segmentId].store(segment, std::memory_order_release);
+    poolsCount++;
+
+    pushFront(nodes[0], nodes[poolSize - 1]);
+}
+
+template <typename NodeType>
+void TagFreeList<NodeType>::pushFront(NodeType &first, NodeType &last) {
+    auto currentHead = head.load(std::memory_order_relaxed);
+    do {
+        last.nextFreeListIndex.store(getIndex(currentHead), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(currentHead, makeHead(currentHead, first.freeListIndex), std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename NodeType>
+void TagFreeList<NodeType>::pushFrontOne(NodeType &node) {
+    pushFront(node, node);
+}
+
+template <typename NodeType>
+NodeType *TagFreeList<NodeType>::removeFrontOne() {
+    auto currentHead = head.load(std::memory_order_acquire);
+    NodeType *node = nullptr;
+    do {
+        node = getNode(getIndex(currentHead));
+        if (node == nullptr) {
+            return nullptr;
+        }
+        // node may be concurrently removed and pushed back, the ABA counter in head makes the exchange fail in such case
+    } while (!head.compare_exchange_weak(currentHead, makeHead(currentHead, node->nextFreeListIndex.load(std::memory_order_relaxed)), std::memory_order_acquire, std::memory_order_acquire));
+    return node;
+}
+
+template <typename NodeType>
+bool TagFreeList<NodeType>::peekContains(const NodeType &node) const {
+    for (auto current = peekHead(); current != nullptr; current = peekNext(*current)) {
+        if (current == &node) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <typename TagType>
 TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment,
                                     size_t tagSize, bool doNotReleaseNodes, DeviceBitfield deviceBitfield)
-    : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield) {
+    : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), freeTags(tagCount) {
 
     populateFreeTags();
 }
@@ -22,13 +96,16 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
     if (freeTags.peekIsEmpty()) {
         releaseDeferredTags();
     }
-    auto node = freeTags.removeFrontOne().release();
+    auto node = freeTags.removeFrontOne();
     if (!node) {
         std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
-        node = freeTags.removeFrontOne().release();
+        node = freeTags.removeFrontOne();
+        while (!node) {
+            populateFreeTags();
+            node = freeTags.removeFrontOne();
+        }
     }
-    usedTags.pushFrontOne(*node);
+    usedTagsCount++;
     node->incRefCount();
     node->initialize();
     return node;
@@ -36,40 +113,35 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
+    DEBUG_BREAK_IF(usedTagsCount == 0);
+    usedTagsCount--;
 
-    freeTags.pushFrontOne(*nodeT);
+    freeTags.pushFrontOne(*static_cast<NodeType *>(node));
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
-    auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    DEBUG_BREAK_IF(usedTagsCount == 0);
+    usedTagsCount--;
+
+    deferredTags.pushFrontOne(*static_cast<NodeType *>(node));
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::releaseDeferredTags() {
-    IDList<NodeType, false> pendingFreeTags;
     IDList<NodeType, false> pendingDeferredTags;
     auto currentNode = deferredTags.detachNodes();
 
     while (currentNode != nullptr) {
         auto nextNode = currentNode->next;
         if (currentNode->canBeReleased()) {
-            pendingFreeTags.pushFrontOne(*currentNode);
+            freeTags.pushFrontOne(*currentNode);
         } else {
             pendingDeferredTags.pushFrontOne(*currentNode);
         }
         currentNode = nextNode;
     }
 
-    if (!pendingFreeTags.peekIsEmpty()) {
-        freeTags.splice(*pendingFreeTags.detachNodes());
-    }
     if (!pendingDeferredTags.peekIsEmpty()) {
         deferredTags.splice(*pendingDeferredTags.detachNodes());
     }
@@ -111,10 +183,9 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(ptrOffset(baseCpuAddress, tagOffset));
         nodesMemory[i].gpuAddress = baseGpuAddress + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
-
-        freeTags.pushTailOne(nodesMemory[i]);
     }
 
+    freeTags.addPool(nodesMemory.get());
     tagPoolMemory.push_back(std::move(nodesMemory));
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,18 +8,40 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/cpu_info.h"
 
 namespace NEO {
 
 namespace WaitUtils {
 
 uint32_t waitCount = defaultWaitCount;
+int64_t yieldThresholdInMicroSeconds = defaultYieldThresholdInMicroSeconds;
+int64_t blockThresholdInMicroSeconds = defaultBlockThresholdInMicroSeconds;
+int64_t blockTimeInMicroSeconds = defaultBlockTimeInMicroSeconds;
+uint64_t waitpkgCounterValue = defaultWaitpkgCounterValue;
+bool waitpkgUse = false;
 
 void init() {
     int32_t overrideWaitCount = DebugManager.flags.WaitLoopCount.get();
     if (overrideWaitCount != -1) {
         waitCount = static_cast<uint32_t>(overrideWaitCount);
     }
+    if (DebugManager.flags.WaitYieldThresholdInMicroSeconds.get() != -1) {
+        yieldThresholdInMicroSeconds = DebugManager.flags.WaitYieldThresholdInMicroSeconds.get();
+    }
+    if (DebugManager.flags.WaitBlockThresholdInMicroSeconds.get() != -1) {
+        blockThresholdInMicroSeconds = DebugManager.flags.WaitBlockThresholdInMicroSeconds.get();
+    }
+    if (DebugManager.flags.WaitBlockTimeInMicroSeconds.get() != -1) {
+        blockTimeInMicroSeconds = DebugManager.flags.WaitBlockTimeInMicroSeconds.get();
+    }
+    if (DebugManager.flags.WaitpkgCounterValue.get() != -1) {
+        waitpkgCounterValue = static_cast<uint64_t>(DebugManager.flags.WaitpkgCounterValue.get());
+    }
+    waitpkgUse = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg);
+    if (DebugManager.flags.EnableWaitpkg.get() != -1) {
+        waitpkgUse &= !!DebugManager.flags.EnableWaitpkg.get();
+    }
 }
 
 } // namespace WaitUtils
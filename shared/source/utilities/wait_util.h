@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -18,24 +19,51 @@ namespace NEO {
 namespace WaitUtils {
 
 constexpr uint32_t defaultWaitCount = 1u;
+constexpr int64_t defaultYieldThresholdInMicroSeconds = 0;
+constexpr int64_t defaultBlockThresholdInMicroSeconds = 0;
+constexpr int64_t defaultBlockTimeInMicroSeconds = 10;
+constexpr uint64_t defaultWaitpkgCounterValue = 16000u;
+constexpr uint32_t umwaitControlC01 = 1u;
+
 extern uint32_t waitCount;
+extern int64_t yieldThresholdInMicroSeconds;
+extern int64_t blockThresholdInMicroSeconds;
+extern int64_t blockTimeInMicroSeconds;
+extern uint64_t waitpkgCounterValue;
+extern bool waitpkgUse;
 
-template <typename T>
-inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+// Waiting escalates with time elapsed since wait started:
+// spin below yield threshold, spin and yield below block threshold,
+// then wait for write to poll address with umwait or sleep when waitpkg is not available.
+// Blocking is disabled by default (block threshold 0).
+template <typename T, typename PredicateT>
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, PredicateT predicate, int64_t timeElapsedSinceWaitStarted = 0) {
     for (uint32_t i = 0; i < waitCount; i++) {
         CpuIntrinsics::pause();
     }
+    const bool block = blockThresholdInMicroSeconds > 0 && timeElapsedSinceWaitStarted >= blockThresholdInMicroSeconds;
+    const bool monitor = block && waitpkgUse && pollAddress != nullptr;
+    if (monitor) {
+        CpuIntrinsics::umonitor(pollAddress);
+    }
     if (pollAddress != nullptr) {
-        if (predicate(*pollAddress, expectedValue)) {
+        const T currentValue = *pollAddress;
+        if (predicate(currentValue, expectedValue)) {
             return true;
         }
     }
-    std::this_thread::yield();
+    if (monitor) {
+        CpuIntrinsics::umwait(umwaitControlC01, CpuIntrinsics::rdtsc() + waitpkgCounterValue);
+    } else if (block) {
+        std::this_thread::sleep_for(std::chrono::microseconds(blockTimeInMicroSeconds));
+    } else if (timeElapsedSinceWaitStarted >= yieldThresholdInMicroSeconds) {
+        std::this_thread::yield();
+    }
     return false;
 }
 
-inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue) {
-    return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
+inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue, int64_t timeElapsedSinceWaitStarted = 0) {
+    return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>(), timeElapsedSinceWaitStarted);
 }
 
 void init();
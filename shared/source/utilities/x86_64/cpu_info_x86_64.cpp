@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,14 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[1] & mask) == mask ? featureAvX2 : featureNone;
         }
+        {
+            // AVX512F and AVX512BW
+            auto mask = BIT(16) | BIT(30);
+            features |= (cpuInfo[1] & mask) == mask ? featureAvX512 : featureNone;
+        }
+        {
+            features |= cpuInfo[2] & BIT(5) ? featureWaitpkg : featureNone;
+        }
     }
 
     cpuid(cpuInfo, 0x80000000);
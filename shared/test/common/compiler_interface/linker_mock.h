@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@ struct WhiteBox<NEO::LinkerInput> : NEO::LinkerInput {
     using BaseClass::kernelDependencies;
     using BaseClass::localSymbols;
     using BaseClass::parseRelocationForExtFuncUsage;
+    using BaseClass::relocationPlan;
     using BaseClass::symbols;
     using BaseClass::textRelocations;
     using BaseClass::traits;
@@ -42,6 +43,7 @@ struct WhiteBox<NEO::Linker> : NEO::Linker {
     using BaseClass::localRelocatedSymbols;
     using BaseClass::patchDataSegments;
     using BaseClass::patchInstructionsSegments;
+    using BaseClass::pImplicitArgsRelocationAddresses;
     using BaseClass::processRelocations;
     using BaseClass::relocatedSymbols;
     using BaseClass::resolveExternalFunctions;
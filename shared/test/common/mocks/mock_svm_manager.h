@@ -15,6 +15,7 @@
 namespace NEO {
 struct MockSVMAllocsManager : public SVMAllocsManager {
   public:
+    using SVMAllocsManager::insertIntoUsmAllocationsCache;
     using SVMAllocsManager::memoryManager;
     using SVMAllocsManager::mtxForIndirectAccess;
     using SVMAllocsManager::multiOsContextSupport;
@@ -23,6 +24,10 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::svmMapOperations;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
+    using SVMAllocsManager::usmHostAllocationsCache;
+    using SVMAllocsManager::usmHostAllocationsCacheEnabled;
+    using SVMAllocsManager::usmSharedAllocationsCache;
+    using SVMAllocsManager::usmSharedAllocationsCacheEnabled;
 };
 
 template <bool enableLocalMemory>
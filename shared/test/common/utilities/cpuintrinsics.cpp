@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,10 @@ std::atomic<uintptr_t> lastClFlushedPtr(0u);
 std::atomic<uint32_t> clFlushCounter(0u);
 std::atomic<uint32_t> pauseCounter(0u);
 std::atomic<uint32_t> sfenceCounter(0u);
+std::atomic<uint32_t> umwaitCounter(0u);
+std::atomic<uintptr_t> lastUmonitorPtr(0u);
+std::atomic<uint64_t> lastUmwaitCounter(0u);
+std::atomic<uint64_t> rdtscValue(0u);
 
 volatile TagAddressType *pauseAddress = nullptr;
 TaskCountType pauseValue = 0u;
@@ -52,5 +56,19 @@ void pause() {
     }
 }
 
+void umonitor(void const volatile *ptr) {
+    CpuIntrinsicsTests::lastUmonitorPtr = reinterpret_cast<uintptr_t>(ptr);
+}
+
+uint8_t umwait(uint32_t control, uint64_t counter) {
+    CpuIntrinsicsTests::umwaitCounter++;
+    CpuIntrinsicsTests::lastUmwaitCounter = counter;
+    return 0u;
+}
+
+uint64_t rdtsc() {
+    return CpuIntrinsicsTests::rdtscValue;
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -205,6 +205,20 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, WhenGettingCachedFileNameThenFull128BitHashIsUsed) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel void k() {}";
+    ArrayRef<const char> input(src, sizeof(src));
+    ArrayRef<const char> apiOptions;
+    ArrayRef<const char> internalOptions;
+
+    CompilerCache cache(CompilerCacheConfig{});
+    std::string hash = cache.getCachedFileName(hwInfo, input, apiOptions, internalOptions);
+
+    EXPECT_EQ(32u, hash.size());
+    EXPECT_EQ(std::string::npos, hash.find_first_not_of("0123456789abcdef"));
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.BinaryCacheTrace.set(true);
@@ -307,6 +321,249 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+class CompilerCacheWithEvictionMock : public CompilerCache {
+  public:
+    using CompilerCache::cachedFilesSize;
+    using CompilerCache::temporaryFileMinEvictionAge;
+
+    CompilerCacheWithEvictionMock(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    bool writeBinaryAtomically(const std::string &filePath, const char *pBinary, size_t binarySize) override {
+        writeBinaryAtomicallyCalled++;
+        if (callBaseWriteBinaryAtomically) {
+            return CompilerCache::writeBinaryAtomically(filePath, pBinary, binarySize);
+        }
+        if (writeBinaryResult) {
+            cachedFiles.erase(std::remove_if(cachedFiles.begin(), cachedFiles.end(), [&](const auto &file) { return file.path == filePath; }), cachedFiles.end());
+            cachedFiles.push_back({filePath, binarySize, ++currentTime});
+        }
+        return writeBinaryResult;
+    }
+
+    bool renameCachedFile(const std::string &oldFilePath, const std::string &newFilePath) override {
+        renamedFiles.push_back({oldFilePath, newFilePath});
+        return renameResult;
+    }
+
+    size_t getCachedFileSize(const std::string &filePath) override {
+        for (const auto &file : cachedFiles) {
+            if (file.path == filePath) {
+                return file.size;
+            }
+        }
+        return 0u;
+    }
+
+    void updateLastAccessTime(const std::string &filePath) override {
+        for (auto &file : cachedFiles) {
+            if (file.path == filePath) {
+                file.lastAccessTime = ++currentTime;
+            }
+        }
+    }
+
+    std::vector<CachedFileInfo> getCachedFiles() override {
+        getCachedFilesCalled++;
+        return cachedFiles;
+    }
+
+    bool removeCachedFile(const std::string &filePath) override {
+        removedFiles.push_back(filePath);
+        cachedFiles.erase(std::remove_if(cachedFiles.begin(), cachedFiles.end(), [&](const auto &file) { return file.path == filePath; }), cachedFiles.end());
+        return true;
+    }
+
+    std::vector<CachedFileInfo> cachedFiles;
+    std::vector<std::string> removedFiles;
+    std::vector<std::pair<std::string, std::string>> renamedFiles;
+    time_t currentTime = 10;
+    uint32_t writeBinaryAtomicallyCalled = 0u;
+    uint32_t getCachedFilesCalled = 0u;
+    bool writeBinaryResult = true;
+    bool callBaseWriteBinaryAtomically = false;
+    bool renameResult = true;
+};
+
+TEST(CompilerCacheTests, GivenNoCacheSizeLimitWhenCachingBinaryThenCacheDirectoryIsNotScanned) {
+    CompilerCacheWithEvictionMock cache(CompilerCacheConfig{});
+    const char binary[32] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_EQ(1u, cache.writeBinaryAtomicallyCalled);
+    EXPECT_EQ(0u, cache.getCachedFilesCalled);
+    EXPECT_TRUE(cache.removedFiles.empty());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinaryThatFitsThenNothingIsEvicted) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"cache/a.ext", 40u, 1});
+    const char binary[16] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("b", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("c", binary, sizeof(binary)));
+    EXPECT_EQ(1u, cache.getCachedFilesCalled);
+    EXPECT_TRUE(cache.removedFiles.empty());
+    EXPECT_EQ(72u, cache.cachedFilesSize);
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinaryThatExceedsLimitThenLeastRecentlyUsedFilesAreEvicted) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"cache/a.ext", 40u, 1});
+    cache.cachedFiles.push_back({"cache/b.ext", 40u, 3});
+    cache.cachedFiles.push_back({"cache/c.ext", 10u, 2});
+    const char binary[30] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("d", binary, sizeof(binary)));
+
+    ASSERT_EQ(2u, cache.removedFiles.size());
+    EXPECT_EQ("cache/a.ext", cache.removedFiles[0]);
+    EXPECT_EQ("cache/c.ext", cache.removedFiles[1]);
+    EXPECT_EQ(70u, cache.cachedFilesSize);
+    EXPECT_LE(cache.cachedFilesSize, config.cacheSize - config.cacheSize / 4);
+}
+
+TEST(CompilerCacheTests, GivenBinaryLargerThanCacheSizeLimitWhenCachingThenBinaryIsNotCached) {
+    CompilerCacheConfig config;
+    config.cacheSize = 16u;
+    CompilerCacheWithEvictionMock cache(config);
+    const char binary[32] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_EQ(0u, cache.writeBinaryAtomicallyCalled);
+    EXPECT_EQ(0u, cache.getCachedFilesCalled);
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenWritingBinaryFailsThenReservedSpaceIsReleased) {
+    CompilerCacheConfig config;
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"a", 40u, 1});
+    cache.writeBinaryResult = false;
+    const char binary[32] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_EQ(1u, cache.writeBinaryAtomicallyCalled);
+    EXPECT_EQ(40u, cache.cachedFilesSize);
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenBinaryWithSameHashIsCachedAgainThenReplacedFileIsNotAccountedTwice) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"cache/a.ext", 40u, 1});
+    const char binary[30] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("b", binary, sizeof(binary)));
+    EXPECT_EQ(70u, cache.cachedFilesSize);
+    EXPECT_TRUE(cache.cacheBinary("b", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("b", binary, 20u));
+    EXPECT_EQ(60u, cache.cachedFilesSize);
+    EXPECT_TRUE(cache.removedFiles.empty());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenReplacingBinaryFailsThenReplacedFileRemainsAccounted) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"cache/a.ext", 40u, 1});
+    cache.writeBinaryResult = false;
+    const char binary[30] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("a", binary, sizeof(binary)));
+    EXPECT_EQ(40u, cache.cachedFilesSize);
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenEvictingForReplacedBinaryThenReplacedFileIsNotEvictedNorAccounted) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    cache.cachedFiles.push_back({"cache/a.ext", 40u, 1});
+    cache.cachedFiles.push_back({"cache/b.ext", 50u, 2});
+    const char binary[70] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+    ASSERT_EQ(1u, cache.removedFiles.size());
+    EXPECT_EQ("cache/b.ext", cache.removedFiles[0]);
+    EXPECT_EQ(70u, cache.cachedFilesSize);
+}
+
+TEST(CompilerCacheTests, GivenStaleTemporaryFileWhenEvictingThenItIsEvictedByAgeAndFreshTemporaryFileIsKept) {
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    config.cacheSize = 100u;
+    CompilerCacheWithEvictionMock cache(config);
+    const auto currentTime = std::time(nullptr);
+    cache.cachedFiles.push_back({"cache/a.ext", 30u, currentTime - 1});
+    cache.cachedFiles.push_back({"cache/b.ext.1_0.tmp", 40u, currentTime - CompilerCacheWithEvictionMock::temporaryFileMinEvictionAge, true});
+    cache.cachedFiles.push_back({"cache/c.ext.2_0.tmp", 20u, currentTime, true});
+    const char binary[40] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("d", binary, sizeof(binary)));
+    ASSERT_EQ(1u, cache.removedFiles.size());
+    EXPECT_EQ("cache/b.ext.1_0.tmp", cache.removedFiles[0]);
+}
+
+TEST(CompilerCacheTests, WhenWritingBinaryAtomicallyThenTemporaryFileIsWrittenThroughIoFunctionsAndRenamed) {
+    VariableBackup<size_t> mockFwriteReturnBackup(&IoFunctions::mockFwriteReturn);
+    VariableBackup<uint32_t> mockFopenCalledBackup(&IoFunctions::mockFopenCalled, 0u);
+    VariableBackup<uint32_t> mockFcloseCalledBackup(&IoFunctions::mockFcloseCalled, 0u);
+    VariableBackup<uint32_t> mockFwriteCalledBackup(&IoFunctions::mockFwriteCalled, 0u);
+
+    CompilerCacheConfig config;
+    config.cacheDir = "cache";
+    config.cacheFileExtension = ".ext";
+    CompilerCacheWithEvictionMock cache(config);
+    cache.callBaseWriteBinaryAtomically = true;
+    const char binary[32] = {};
+    IoFunctions::mockFwriteReturn = sizeof(binary);
+
+    EXPECT_TRUE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_EQ(1u, IoFunctions::mockFopenCalled);
+    EXPECT_EQ(1u, IoFunctions::mockFwriteCalled);
+    EXPECT_EQ(1u, IoFunctions::mockFcloseCalled);
+
+    std::string filePath = config.cacheDir + PATH_SEPARATOR + "hash" + config.cacheFileExtension;
+    ASSERT_EQ(1u, cache.renamedFiles.size());
+    EXPECT_EQ(0u, cache.renamedFiles[0].first.find(filePath + "."));
+    EXPECT_NE(filePath, cache.renamedFiles[0].first);
+    EXPECT_EQ(filePath, cache.renamedFiles[0].second);
+    EXPECT_TRUE(cache.removedFiles.empty());
+}
+
+TEST(CompilerCacheTests, WhenWritingOrRenamingTemporaryFileFailsThenTemporaryFileIsRemovedAndBinaryIsNotCached) {
+    VariableBackup<size_t> mockFwriteReturnBackup(&IoFunctions::mockFwriteReturn);
+    CompilerCacheWithEvictionMock cache(CompilerCacheConfig{});
+    cache.callBaseWriteBinaryAtomically = true;
+    const char binary[32] = {};
+
+    IoFunctions::mockFwriteReturn = sizeof(binary) - 1;
+    EXPECT_FALSE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.renamedFiles.empty());
+    ASSERT_EQ(1u, cache.removedFiles.size());
+
+    IoFunctions::mockFwriteReturn = sizeof(binary);
+    cache.renameResult = false;
+    EXPECT_FALSE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    ASSERT_EQ(1u, cache.renamedFiles.size());
+    ASSERT_EQ(2u, cache.removedFiles.size());
+    EXPECT_EQ(cache.renamedFiles[0].first, cache.removedFiles[1]);
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
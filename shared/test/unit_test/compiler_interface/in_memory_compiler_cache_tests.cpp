@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+struct InMemoryCompilerCacheTests : public ::testing::Test {
+    void TearDown() override {
+        InMemoryCompilerCache::getInstance().clear();
+    }
+};
+
+TEST_F(InMemoryCompilerCacheTests, GivenNoMemoryBudgetWhenStoringBinaryThenBinaryIsNotStored) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    const char binary[16] = {};
+
+    EXPECT_FALSE(inMemoryCache.store("hash", binary, sizeof(binary)));
+    EXPECT_EQ(0u, inMemoryCache.getUsedMemory());
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenStoredBinaryWhenLoadingThenCopyIsReturnedAndHitIsCounted) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    inMemoryCache.increaseMemoryBudget(64u);
+    const char binary[] = "binary";
+
+    EXPECT_TRUE(inMemoryCache.store("hash", binary, sizeof(binary)));
+    EXPECT_EQ(sizeof(binary), inMemoryCache.getUsedMemory());
+
+    size_t size = 0u;
+    auto loadedBinary = inMemoryCache.load("hash", size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), size));
+    EXPECT_NE(binary, loadedBinary.get());
+
+    auto notStoredBinary = inMemoryCache.load("other_hash", size);
+    EXPECT_EQ(nullptr, notStoredBinary);
+    EXPECT_EQ(0u, size);
+
+    EXPECT_EQ(1u, inMemoryCache.getHitCount());
+    EXPECT_EQ(1u, inMemoryCache.getMissCount());
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenMemoryBudgetExceededWhenStoringBinaryThenLeastRecentlyUsedBinaryIsEvicted) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    inMemoryCache.increaseMemoryBudget(32u);
+    const char binary[16] = {};
+
+    EXPECT_TRUE(inMemoryCache.store("a", binary, sizeof(binary)));
+    EXPECT_TRUE(inMemoryCache.store("b", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, inMemoryCache.load("a", size));
+
+    EXPECT_TRUE(inMemoryCache.store("c", binary, sizeof(binary)));
+    EXPECT_EQ(32u, inMemoryCache.getUsedMemory());
+
+    EXPECT_NE(nullptr, inMemoryCache.load("a", size));
+    EXPECT_EQ(nullptr, inMemoryCache.load("b", size));
+    EXPECT_NE(nullptr, inMemoryCache.load("c", size));
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenBinaryLargerThanBudgetWhenStoringThenBinaryIsNotStored) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    inMemoryCache.increaseMemoryBudget(8u);
+    const char binary[16] = {};
+
+    EXPECT_FALSE(inMemoryCache.store("hash", binary, sizeof(binary)));
+    EXPECT_EQ(0u, inMemoryCache.getUsedMemory());
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenAlreadyStoredHashWhenStoringAgainThenEntryIsReplaced) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    inMemoryCache.increaseMemoryBudget(64u);
+    const char binary1[16] = {};
+    const char binary2[8] = {1};
+
+    EXPECT_TRUE(inMemoryCache.store("hash", binary1, sizeof(binary1)));
+    EXPECT_TRUE(inMemoryCache.store("hash", binary2, sizeof(binary2)));
+    EXPECT_EQ(sizeof(binary2), inMemoryCache.getUsedMemory());
+
+    size_t size = 0u;
+    auto loadedBinary = inMemoryCache.load("hash", size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary2), size);
+    EXPECT_EQ(1, loadedBinary[0]);
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenSmallerBudgetWhenIncreasingMemoryBudgetThenLargerBudgetIsKept) {
+    auto &inMemoryCache = InMemoryCompilerCache::getInstance();
+    inMemoryCache.increaseMemoryBudget(64u);
+    inMemoryCache.increaseMemoryBudget(32u);
+    EXPECT_EQ(64u, inMemoryCache.getMemoryBudget());
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenCompilerCacheWithInMemoryTierWhenBinaryIsCachedThenItIsLoadedFromMemory) {
+    CompilerCacheConfig config;
+    config.cacheDir = "non_existing_cache_dir";
+    config.cacheFileExtension = ".ext";
+    config.inMemoryCacheSize = 64u;
+    CompilerCache cache(config);
+    const char binary[] = "binary";
+
+    EXPECT_EQ(64u, InMemoryCompilerCache::getInstance().getMemoryBudget());
+
+    cache.cacheBinary("hash", binary, sizeof(binary));
+
+    size_t size = 0u;
+    auto loadedBinary = cache.loadCachedBinary("hash", size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), size));
+    EXPECT_EQ(1u, InMemoryCompilerCache::getInstance().getHitCount());
+}
+
+TEST_F(InMemoryCompilerCacheTests, GivenCompilerCacheWithoutInMemoryTierWhenBinaryIsCachedThenInMemoryTierIsNotUsed) {
+    CompilerCacheConfig config;
+    config.cacheDir = "non_existing_cache_dir";
+    config.cacheFileExtension = ".ext";
+    CompilerCache cache(config);
+    const char binary[] = "binary";
+
+    cache.cacheBinary("hash", binary, sizeof(binary));
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("hash", size));
+    EXPECT_EQ(0u, InMemoryCompilerCache::getInstance().getUsedMemory());
+    EXPECT_EQ(0u, InMemoryCompilerCache::getInstance().getMissCount());
+}
@@ -2879,3 +2879,159 @@ TEST(LinkerTest, givenLocalFuncSymbolsWhenProcessingRelocationsThenLocalSymbolsA
     const auto &localRelocatedSymbolInfo = linker.localRelocatedSymbols.at(kernelName);
     EXPECT_EQ(emplacedTargeted.gpuAddress + localSymInfo.offset, localRelocatedSymbolInfo.gpuAddress);
 }
+
+TEST(LinkerTests, givenDecodedTextRelocationsWhenGettingRelocationPlanThenSymbolNamesAreInternedAndPlanIsReusedByConsecutiveLinks) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo relocA;
+    relocA.offset = 0U;
+    relocA.type = NEO::LinkerInput::RelocationInfo::Type::AddressLow;
+    relocA.symbolName = "A";
+    auto relocAHigh = relocA;
+    relocAHigh.offset = 4U;
+    relocAHigh.type = NEO::LinkerInput::RelocationInfo::Type::AddressHigh;
+    auto relocB = relocA;
+    relocB.offset = 8U;
+    relocB.symbolName = "B";
+    linkerInput.addElfTextSegmentRelocation(relocA, 0u);
+    linkerInput.addElfTextSegmentRelocation(relocAHigh, 0u);
+    linkerInput.addElfTextSegmentRelocation(relocB, 1u);
+    linkerInput.addElfTextSegmentRelocation(relocA, 1u);
+
+    auto &plan = linkerInput.getRelocationPlan();
+    EXPECT_TRUE(plan.isValidFor(linkerInput.getRelocationsInInstructionSegments()));
+    ASSERT_EQ(2u, plan.symbolNames.size());
+    EXPECT_EQ("A", plan.symbolNames[0]);
+    EXPECT_EQ("B", plan.symbolNames[1]);
+    ASSERT_EQ(2u, plan.symbolIdsPerInstSegment.size());
+    EXPECT_EQ((std::vector<uint32_t>{0u, 0u}), plan.symbolIdsPerInstSegment[0]);
+    EXPECT_EQ((std::vector<uint32_t>{1u, 0u}), plan.symbolIdsPerInstSegment[1]);
+
+    uint32_t segmentData[2][4] = {};
+    NEO::Linker::PatchableSegments segmentsToPatch(2);
+    for (uint32_t segId = 0u; segId < 2u; segId++) {
+        segmentsToPatch[segId].hostPointer = segmentData[segId];
+        segmentsToPatch[segId].segmentSize = sizeof(segmentData[segId]);
+    }
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+
+    for (uint64_t symbolAValue : {0x1200000034ULL, 0x5600000078ULL}) {
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        linker.relocatedSymbols["A"].gpuAddress = static_cast<uintptr_t>(symbolAValue);
+        NEO::Linker::UnresolvedExternals unresolvedExternals;
+        linker.patchInstructionsSegments(segmentsToPatch, unresolvedExternals, kernelDescriptors);
+
+        EXPECT_EQ(&plan, &linkerInput.getRelocationPlan());
+        EXPECT_EQ(2u, plan.symbolNames.size());
+        EXPECT_EQ(static_cast<uint32_t>(symbolAValue), segmentData[0][0]);
+        EXPECT_EQ(static_cast<uint32_t>(symbolAValue >> 32), segmentData[0][1]);
+        EXPECT_EQ(static_cast<uint32_t>(symbolAValue), segmentData[1][0]);
+        ASSERT_EQ(1u, unresolvedExternals.size());
+        EXPECT_EQ("B", unresolvedExternals[0].unresolvedRelocation.symbolName);
+        EXPECT_EQ(1u, unresolvedExternals[0].instructionsSegmentId);
+    }
+}
+
+TEST(LinkerTests, givenTextRelocationsAddedOutsideOfDecodingWhenPatchingInstructionSegmentsThenSymbolsAreResolvedFromRebuiltPlan) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    NEO::LinkerInput::RelocationInfo relocA;
+    relocA.offset = 0U;
+    relocA.type = NEO::LinkerInput::RelocationInfo::Type::AddressLow;
+    relocA.symbolName = "A";
+    relocA.relocationSegment = NEO::SegmentType::Instructions;
+    auto relocB = relocA;
+    relocB.offset = 4U;
+    relocB.symbolName = "B";
+    linkerInput.addElfTextSegmentRelocation(relocA, 0u);
+    linkerInput.textRelocations[0].push_back(relocB);
+    EXPECT_FALSE(linkerInput.getRelocationPlan().isValidFor(linkerInput.getRelocationsInInstructionSegments()));
+
+    uint32_t segmentData[4] = {};
+    NEO::Linker::PatchableSegments segmentsToPatch(1);
+    segmentsToPatch[0].hostPointer = segmentData;
+    segmentsToPatch[0].segmentSize = sizeof(segmentData);
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.relocatedSymbols["A"].gpuAddress = 0x12;
+    linker.relocatedSymbols["B"].gpuAddress = 0x34;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    linker.patchInstructionsSegments(segmentsToPatch, unresolvedExternals, kernelDescriptors);
+
+    EXPECT_TRUE(unresolvedExternals.empty());
+    EXPECT_EQ(0x12u, segmentData[0]);
+    EXPECT_EQ(0x34u, segmentData[1]);
+}
+
+TEST(LinkerTests, givenLinkerPatchingThreadsWhenPatchingInstructionSegmentsThenResultsMatchSerialPatching) {
+    constexpr uint32_t segmentsCount = 8u;
+    constexpr uint32_t relocationsPerSegment = 16u;
+
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    linkerInput.textRelocations.resize(segmentsCount);
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t relocId = 0u; relocId < relocationsPerSegment; relocId++) {
+            NEO::LinkerInput::RelocationInfo relocation;
+            relocation.offset = relocId * sizeof(uint64_t);
+            relocation.type = NEO::LinkerInput::RelocationInfo::Type::Address;
+            relocation.relocationSegment = NEO::SegmentType::Instructions;
+            relocation.addend = segId;
+            if (relocId % 5 == 4) {
+                relocation.symbolName = "unresolved" + std::to_string(segId);
+            } else if (relocId % 7 == 6) {
+                relocation.symbolName = NEO::implicitArgsRelocationSymbolName;
+            } else {
+                relocation.symbolName = "sym" + std::to_string(relocId % 3);
+            }
+            linkerInput.textRelocations[segId].push_back(relocation);
+        }
+    }
+
+    auto patchSegments = [&](int32_t threadsCount, std::vector<std::vector<uint64_t>> &segmentsData, NEO::Linker::UnresolvedExternals &unresolvedExternals, size_t &implicitArgsRelocationsCount) {
+        DebugManagerStateRestore restorer;
+        NEO::DebugManager.flags.LinkerPatchingThreads.set(threadsCount);
+
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        for (uint32_t symId = 0u; symId < 3u; symId++) {
+            linker.relocatedSymbols["sym" + std::to_string(symId)].gpuAddress = 0x10000u * (symId + 1);
+        }
+
+        segmentsData.assign(segmentsCount, std::vector<uint64_t>(relocationsPerSegment, 0u));
+        NEO::Linker::PatchableSegments segmentsToPatch(segmentsCount);
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            segmentsToPatch[segId].hostPointer = segmentsData[segId].data();
+            segmentsToPatch[segId].segmentSize = segmentsData[segId].size() * sizeof(uint64_t);
+        }
+        NEO::Linker::KernelDescriptorsT kernelDescriptors;
+        linker.patchInstructionsSegments(segmentsToPatch, unresolvedExternals, kernelDescriptors);
+
+        implicitArgsRelocationsCount = 0u;
+        for (const auto &[segId, relocationAddresses] : linker.pImplicitArgsRelocationAddresses) {
+            implicitArgsRelocationsCount += relocationAddresses.size();
+        }
+    };
+
+    std::vector<std::vector<uint64_t>> serialData;
+    NEO::Linker::UnresolvedExternals serialUnresolvedExternals;
+    size_t serialImplicitArgsRelocationsCount = 0u;
+    patchSegments(-1, serialData, serialUnresolvedExternals, serialImplicitArgsRelocationsCount);
+    EXPECT_NE(0u, serialUnresolvedExternals.size());
+    EXPECT_NE(0u, serialImplicitArgsRelocationsCount);
+
+    for (auto threadsCount : {0, 1, 4}) {
+        std::vector<std::vector<uint64_t>> data;
+        NEO::Linker::UnresolvedExternals unresolvedExternals;
+        size_t implicitArgsRelocationsCount = 0u;
+        patchSegments(threadsCount, data, unresolvedExternals, implicitArgsRelocationsCount);
+
+        EXPECT_EQ(serialData, data);
+        EXPECT_EQ(serialImplicitArgsRelocationsCount, implicitArgsRelocationsCount);
+        ASSERT_EQ(serialUnresolvedExternals.size(), unresolvedExternals.size());
+        for (size_t i = 0; i < unresolvedExternals.size(); i++) {
+            EXPECT_EQ(serialUnresolvedExternals[i].unresolvedRelocation.symbolName, unresolvedExternals[i].unresolvedRelocation.symbolName);
+            EXPECT_EQ(serialUnresolvedExternals[i].unresolvedRelocation.offset, unresolvedExternals[i].unresolvedRelocation.offset);
+            EXPECT_EQ(serialUnresolvedExternals[i].instructionsSegmentId, unresolvedExternals[i].instructionsSegmentId);
+        }
+    }
+}
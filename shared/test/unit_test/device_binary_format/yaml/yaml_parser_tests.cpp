@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -231,6 +231,38 @@ TEST(YamlConsumeNameIdentifier, GivenNameIdentifierBeginningCharacterThenConsume
     }
 }
 
+TEST(YamlFindCharacter, GivenTextThenReturnsFirstOccurrenceOrEnd) {
+    std::string text(40, 'a');
+    text[35] = '\n';
+    text[37] = '\n';
+    EXPECT_EQ(text.data() + 35, findCharacter(text.data(), text.data() + text.size(), '\n'));
+    EXPECT_EQ(text.data() + 37, findCharacter(text.data() + 36, text.data() + text.size(), '\n'));
+    EXPECT_EQ(text.data() + 35, findCharacter(text.data(), text.data() + 35, '\n'));
+    EXPECT_EQ(text.data() + 10, findCharacter(text.data() + 10, text.data() + 10, '\n'));
+}
+
+TEST(YamlSkipCharacter, GivenTextThenReturnsFirstNonMatchingCharacterOrEnd) {
+    for (size_t numSpaces : {0U, 1U, 15U, 16U, 17U, 31U, 32U, 33U, 70U}) {
+        std::string text(numSpaces, ' ');
+        text += "key";
+        EXPECT_EQ(text.data() + numSpaces, skipCharacter(text.data(), text.data() + text.size(), ' ')) << numSpaces;
+        EXPECT_EQ(text.data() + numSpaces, skipCharacter(text.data(), text.data() + numSpaces, ' ')) << numSpaces;
+    }
+}
+
+TEST(YamlCountCharacter, GivenTextThenCountsAllOccurrences) {
+    std::string text;
+    size_t expectedCount = 0U;
+    for (size_t i = 0; i < 10000; ++i) {
+        bool isNewline = (0U == i % 7) || (0U == i % 16);
+        text += isNewline ? '\n' : 'x';
+        expectedCount += isNewline ? 1U : 0U;
+    }
+    EXPECT_EQ(expectedCount, countCharacter(text.data(), text.data() + text.size(), '\n'));
+    EXPECT_EQ(1U, countCharacter(text.data(), text.data() + 1, '\n'));
+    EXPECT_EQ(0U, countCharacter(text.data(), text.data(), '\n'));
+}
+
 TEST(YamlConsumeStringLiteral, GivenQuotedStringThenConsumeUntilEndingMarkIsMet) {
     ConstStringRef notQuoted = "a+5";
     ConstStringRef singleQuote = "\'abc de fg\'ijkl";
@@ -383,6 +415,38 @@ TEST(YamlTokenize, GivenTabsAsIndentThenEmitsWarning) {
     EXPECT_STREQ("NEO::Yaml : Tabs used as indent at line : 0\nNEO::Yaml : text tokenized to 0 tokens\n", warnings.c_str());
 }
 
+TEST(YamlTokenize, GivenIndentLongerThanScanWidthThenIndentIsCountedCorrectly) {
+    std::string yaml = "a:\n" + std::string(37, ' ') + "b:  c\n";
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    ASSERT_EQ(2U, lines.size());
+    EXPECT_EQ(0U, lines[0].indent);
+    EXPECT_EQ(37U, lines[1].indent);
+    ASSERT_EQ(7U, tokens.size());
+    EXPECT_EQ(tokens[5], "c");
+}
+
+TEST(YamlTokenize, GivenMultilineTextThenCachesArePresizedBasedOnNumberOfLines) {
+    std::string yaml;
+    for (int i = 0; i < 3000; ++i) {
+        yaml += "a: b\n";
+    }
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_EQ(3000U, lines.size());
+    EXPECT_EQ(12000U, tokens.size());
+    EXPECT_LE(3001U, lines.capacity());
+    EXPECT_LE(3001U * estimatedTokensPerLine, tokens.capacity());
+}
+
 TEST(YamlTokenize, WhenTextDoesNotEndWithNewlineThenEmitsWarning) {
     NEO::Yaml::LinesCache lines;
     NEO::Yaml::TokensCache tokens;
@@ -2745,6 +2809,34 @@ not_really_a_bool:
     }
 }
 
+TEST(YamlParserReadValueCheckedConstStringRef, GivenStringLiteralThenReturnsViewIntoSourceText) {
+    ConstStringRef yaml = R"===(
+name : some_kernel
+quoted : "some text"
+size : 8
+)===";
+
+    std::string parserErrors;
+    std::string parserWarnings;
+    NEO::Yaml::YamlParser parser;
+    bool success = parser.parse(yaml, parserErrors, parserWarnings);
+    ASSERT_TRUE(success);
+
+    ConstStringRef name;
+    EXPECT_TRUE(parser.readValueChecked<ConstStringRef>(*parser.getChild(*parser.getRoot(), "name"), name));
+    EXPECT_EQ("some_kernel", name);
+    EXPECT_LE(yaml.begin(), name.begin());
+    EXPECT_GE(yaml.end(), name.end());
+
+    ConstStringRef quoted;
+    EXPECT_TRUE(parser.readValueChecked<ConstStringRef>(*parser.getChild(*parser.getRoot(), "quoted"), quoted));
+    EXPECT_EQ("\"some text\"", quoted);
+
+    ConstStringRef size;
+    EXPECT_FALSE(parser.readValueChecked<ConstStringRef>(*parser.getChild(*parser.getRoot(), "size"), size));
+    EXPECT_TRUE(size.empty());
+}
+
 TEST(YamlParser, GivenSimpleZebinThenParsesItCorrectly) {
     ConstStringRef yaml = R"===(---
 kernels:         
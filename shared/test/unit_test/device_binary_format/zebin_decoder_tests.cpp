@@ -3075,6 +3075,92 @@ kernels:
     EXPECT_EQ(DeviceBinaryFormat::Zebin, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.binaryFormat);
 }
 
+TEST(DecodeZeInfoKernels, GivenZebinKernelDecodeThreadsWhenDecodingMultipleKernelsThenKernelsMatchSerialDecoding) {
+    std::string zeinfo = std::string("version :\'") + versionToString(zeInfoDecoderVersion) + R"===('
+kernels:
+)===";
+    constexpr uint32_t kernelsCount = 32U;
+    for (uint32_t i = 0; i < kernelsCount; ++i) {
+        zeinfo += "    - name : kernel_" + std::to_string(i) + "\n";
+        zeinfo += "      execution_env :\n";
+        zeinfo += "        simd_size : " + std::to_string(8U << (i % 3)) + "\n";
+        zeinfo += "        grf_count : " + std::to_string(128U + i) + "\n";
+    }
+
+    NEO::ProgramInfo serialProgramInfo;
+    std::string serialErrors;
+    std::string serialWarnings;
+    auto serialError = NEO::decodeZeInfo(serialProgramInfo, zeinfo, serialErrors, serialWarnings);
+    EXPECT_EQ(NEO::DecodeError::Success, serialError);
+    ASSERT_EQ(kernelsCount, serialProgramInfo.kernelInfos.size());
+
+    for (auto threadsCount : {0, 1, 4}) {
+        DebugManagerStateRestore dbgRestore;
+        NEO::DebugManager.flags.ZebinKernelDecodeThreads.set(threadsCount);
+
+        NEO::ProgramInfo programInfo;
+        std::string errors;
+        std::string warnings;
+        auto error = NEO::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+        EXPECT_EQ(serialError, error);
+        EXPECT_EQ(serialErrors, errors);
+        EXPECT_EQ(serialWarnings, warnings);
+
+        ASSERT_EQ(kernelsCount, programInfo.kernelInfos.size());
+        for (uint32_t i = 0; i < kernelsCount; ++i) {
+            auto &expected = serialProgramInfo.kernelInfos[i]->kernelDescriptor;
+            auto &decoded = programInfo.kernelInfos[i]->kernelDescriptor;
+            EXPECT_EQ(expected.kernelMetadata.kernelName, decoded.kernelMetadata.kernelName);
+            EXPECT_EQ(expected.kernelAttributes.simdSize, decoded.kernelAttributes.simdSize);
+            EXPECT_EQ(expected.kernelAttributes.numGrfRequired, decoded.kernelAttributes.numGrfRequired);
+        }
+    }
+}
+
+TEST(DecodeZeInfoKernels, GivenZebinKernelDecodeThreadsWhenKernelsFailToDecodeThenErrorsAndWarningsMatchSerialDecoding) {
+    std::string zeinfo = std::string("version :\'") + versionToString(zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : valid_kernel
+      execution_env :
+        simd_size : 8
+      unknown_entry : 1
+    - name : kernel_without_execution_env
+      other_unknown_entry : 2
+    - name : kernel_with_two_names
+      name : second_name
+      execution_env :
+        simd_size : 8
+    - name : last_kernel
+      execution_env :
+        simd_size : 8
+      another_unknown_entry : 3
+)===";
+
+    NEO::ProgramInfo serialProgramInfo;
+    std::string serialErrors;
+    std::string serialWarnings;
+    auto serialError = NEO::decodeZeInfo(serialProgramInfo, zeinfo, serialErrors, serialWarnings);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, serialError);
+    EXPECT_STREQ("DeviceBinaryFormat::Zebin : Expected exactly 1 of execution_env section, got : 0\n", serialErrors.c_str());
+    EXPECT_NE(std::string::npos, serialWarnings.find("unknown_entry"));
+    EXPECT_NE(std::string::npos, serialWarnings.find("other_unknown_entry"));
+    EXPECT_EQ(std::string::npos, serialWarnings.find("another_unknown_entry"));
+
+    for (auto threadsCount : {0, 1, 4}) {
+        DebugManagerStateRestore dbgRestore;
+        NEO::DebugManager.flags.ZebinKernelDecodeThreads.set(threadsCount);
+
+        NEO::ProgramInfo programInfo;
+        std::string errors;
+        std::string warnings;
+        auto error = NEO::decodeZeInfo(programInfo, zeinfo, errors, warnings);
+        EXPECT_EQ(serialError, error);
+        EXPECT_EQ(serialErrors, errors);
+        EXPECT_EQ(serialWarnings, warnings);
+        EXPECT_EQ(serialProgramInfo.kernelInfos.size(), programInfo.kernelInfos.size());
+    }
+}
+
 TEST(DecodeSingleDeviceBinaryZebin, GivenValidZeInfoAndExternalFunctionsMetadataThenPopulatesExternalFunctionMetadataProperly) {
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &gfxCoreHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::GfxCoreHelper>();
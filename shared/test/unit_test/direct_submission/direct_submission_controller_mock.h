@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,10 +12,15 @@
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::DirectSubmissionState;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
+    using DirectSubmissionController::getIdleTicksThreshold;
     using DirectSubmissionController::keepControlling;
+    using DirectSubmissionController::policy;
+    using DirectSubmissionController::policyParameters;
+    using DirectSubmissionController::statistics;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
 
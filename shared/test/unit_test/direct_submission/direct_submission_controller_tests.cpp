@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -386,4 +386,132 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     controller.unregisterDirectSubmission(&csr4);
 }
 
-} // namespace NEO
\ No newline at end of file
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAdaptivePolicyFlagWhenCreateObjectThenPolicyIsEqualWithDebugFlag) {
+    DebugManagerStateRestore restorer;
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_EQ(DirectSubmissionControllerPolicy::Fixed, controller.getPolicy());
+    }
+    DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.set(static_cast<int32_t>(DirectSubmissionControllerPolicy::LowLatency));
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_EQ(DirectSubmissionControllerPolicy::LowLatency, controller.getPolicy());
+        EXPECT_EQ(DirectSubmissionController::getPolicyParameters(DirectSubmissionControllerPolicy::LowLatency).maxIdleTicks, controller.policyParameters.maxIdleTicks);
+    }
+    DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.set(static_cast<int32_t>(DirectSubmissionControllerPolicy::LowPower));
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_EQ(DirectSubmissionControllerPolicy::LowPower, controller.getPolicy());
+    }
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptivePoliciesWhenAverageGapChangesThenIdleThresholdFollowsPredictionWithinPolicyBounds) {
+    DirectSubmissionControllerMock controller;
+    DirectSubmissionControllerMock::DirectSubmissionState state;
+
+    EXPECT_EQ(1u, controller.getIdleTicksThreshold(state));
+    state.averageGapTicks = 100u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(1u, controller.getIdleTicksThreshold(state));
+
+    controller.policyParameters = DirectSubmissionController::getPolicyParameters(DirectSubmissionControllerPolicy::LowLatency);
+    state.averageGapTicks = 1u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(4u, controller.getIdleTicksThreshold(state));
+    state.averageGapTicks = 3u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(12u, controller.getIdleTicksThreshold(state));
+    state.averageGapTicks = 100u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(controller.policyParameters.maxIdleTicks, controller.getIdleTicksThreshold(state));
+
+    controller.policyParameters = DirectSubmissionController::getPolicyParameters(DirectSubmissionControllerPolicy::LowPower);
+    state.averageGapTicks = 1u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(2u, controller.getIdleTicksThreshold(state));
+    state.averageGapTicks = 100u << DirectSubmissionController::gapFractionBits;
+    EXPECT_EQ(controller.policyParameters.maxIdleTicks, controller.getIdleTicksThreshold(state));
+    state.averageGapTicks = 0u;
+    EXPECT_EQ(controller.policyParameters.minIdleTicks, controller.getIdleTicksThreshold(state));
+}
+
+struct DirectSubmissionControllerPolicyTest : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        executionEnvironment.initializeMemoryManager();
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, deviceBitfield);
+        osContext.reset(OsContext::create(nullptr, 0, 0,
+                                          EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                       PreemptionMode::ThreadGroup, deviceBitfield)));
+        csr->setupContext(*osContext);
+    }
+
+    void runBurstyTraffic(DirectSubmissionControllerMock &controller, uint32_t submissions, uint32_t ticksBetweenSubmissions) {
+        controller.keepControlling.store(false);
+        controller.directSubmissionControllingThread->join();
+        controller.directSubmissionControllingThread.reset();
+        controller.registerDirectSubmission(csr.get());
+        for (uint32_t submission = 0u; submission < submissions; submission++) {
+            csr->taskCount++;
+            for (uint32_t tick = 0u; tick < ticksBetweenSubmissions; tick++) {
+                controller.checkNewSubmissions();
+            }
+        }
+        controller.unregisterDirectSubmission(csr.get());
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    DeviceBitfield deviceBitfield{1};
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+    std::unique_ptr<OsContext> osContext;
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(DirectSubmissionControllerPolicyTest, givenFixedPolicyWhenSubmissionsArriveEveryOtherTickThenRingIsStoppedAndRestartedPrematurely) {
+    DirectSubmissionControllerMock controller;
+    runBurstyTraffic(controller, 10u, 2u);
+
+    auto statistics = controller.getStatistics();
+    EXPECT_EQ(10u, statistics.stops);
+    EXPECT_EQ(9u, statistics.restarts);
+    EXPECT_EQ(9u, statistics.prematureStops);
+}
+
+TEST_F(DirectSubmissionControllerPolicyTest, givenLowLatencyPolicyWhenSubmissionsArriveInBurstsThenRingIsKeptRunningBetweenSubmissions) {
+    DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.set(static_cast<int32_t>(DirectSubmissionControllerPolicy::LowLatency));
+    DirectSubmissionControllerMock controller;
+    runBurstyTraffic(controller, 10u, 3u);
+
+    auto statistics = controller.getStatistics();
+    EXPECT_EQ(0u, statistics.stops);
+    EXPECT_EQ(0u, statistics.restarts);
+    EXPECT_EQ(0u, statistics.prematureStops);
+}
+
+TEST_F(DirectSubmissionControllerPolicyTest, givenLowLatencyPolicyWhenCsrIsIdleLongerThanMaxPredictionThenRingIsStopped) {
+    DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.set(static_cast<int32_t>(DirectSubmissionControllerPolicy::LowLatency));
+    DirectSubmissionControllerMock controller;
+    runBurstyTraffic(controller, 3u, controller.policyParameters.maxIdleTicks + 2u);
+
+    auto statistics = controller.getStatistics();
+    EXPECT_EQ(3u, statistics.stops);
+    EXPECT_EQ(2u, statistics.restarts);
+    EXPECT_EQ(0u, statistics.prematureStops);
+}
+
+TEST_F(DirectSubmissionControllerPolicyTest, givenLowPowerPolicyWhenCsrIsIdleThenRingIsStoppedAfterShortPrediction) {
+    DebugManager.flags.DirectSubmissionControllerAdaptivePolicy.set(static_cast<int32_t>(DirectSubmissionControllerPolicy::LowPower));
+    DirectSubmissionControllerMock controller;
+    controller.keepControlling.store(false);
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.registerDirectSubmission(csr.get());
+
+    csr->taskCount++;
+    controller.checkNewSubmissions();
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[csr.get()].isStopped);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(1u, controller.directSubmissions[csr.get()].statistics.stops);
+
+    controller.unregisterDirectSubmission(csr.get());
+    EXPECT_EQ(1u, controller.getStatistics().stops);
+}
+
+} // namespace NEO
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+class MockHash128 : public Hash128 {
+  public:
+    using Hash128::useSimd;
+};
+
+std::vector<char> createTestData(size_t size) {
+    std::vector<char> data(size);
+    uint32_t seed = 0x12345678u;
+    for (auto &byte : data) {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<char>(seed >> 16);
+    }
+    return data;
+}
+} // namespace
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenResultIsDeterministic) {
+    auto data = createTestData(1000);
+
+    auto hash1 = Hash128::hash(data.data(), data.size());
+    auto hash2 = Hash128::hash(data.data(), data.size());
+    EXPECT_EQ(hash1, hash2);
+}
+
+TEST(Hash128Tests, givenInputsDifferingInLengthOrSingleByteWhenHashIsCalculatedThenResultsAreUnique) {
+    auto data = createTestData(2 * Hash128::stripeSize * Hash128::stripesPerBlock + 7);
+    std::set<std::pair<uint64_t, uint64_t>> hashes;
+
+    for (size_t size = 0; size <= data.size(); size++) {
+        auto hash = Hash128::hash(data.data(), size);
+        EXPECT_TRUE(hashes.insert({hash.low, hash.high}).second) << "size " << size;
+    }
+
+    for (size_t idx = 0; idx < data.size(); idx++) {
+        auto modifiedData = data;
+        modifiedData[idx] ^= 1;
+        auto hash = Hash128::hash(modifiedData.data(), modifiedData.size());
+        EXPECT_TRUE(hashes.insert({hash.low, hash.high}).second) << "index " << idx;
+    }
+}
+
+TEST(Hash128Tests, givenTrailingZeroBytesWhenHashIsCalculatedThenResultDiffers) {
+    const char data[4] = {'a', 'b', 'c', '\0'};
+
+    EXPECT_NE(Hash128::hash(data, 3), Hash128::hash(data, 4));
+    EXPECT_NE(Hash128::hash(nullptr, 0), Hash128::hash(data + 3, 1));
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenHashIsUpdatedIncrementallyThenResultMatchesSingleUpdate) {
+    auto data = createTestData(3 * Hash128::stripeSize * Hash128::stripesPerBlock + 13);
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1u, 3u, 16u, 31u, 32u, 33u, 100u, 512u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenSimdAndScalarPathsWhenHashIsCalculatedThenResultsAreBitExact) {
+    auto data = createTestData(4 * Hash128::stripeSize * Hash128::stripesPerBlock + 21);
+
+    for (size_t size = 0; size <= data.size(); size += 7) {
+        MockHash128 simdHash;
+        simdHash.useSimd = true;
+        simdHash.update(data.data(), size);
+
+        MockHash128 scalarHash;
+        scalarHash.useSimd = false;
+        scalarHash.update(data.data(), size);
+
+        EXPECT_EQ(simdHash.finish(), scalarHash.finish()) << "size " << size;
+    }
+}
+
+TEST(Hash128Tests, givenMisalignedBufferWhenHashIsCalculatedThenResultMatchesAlignedBuffer) {
+    auto data = createTestData(257);
+    std::vector<char> misalignedStorage(1);
+    misalignedStorage.insert(misalignedStorage.end(), data.begin(), data.end());
+
+    EXPECT_EQ(Hash128::hash(data.data(), data.size()), Hash128::hash(misalignedStorage.data() + 1, data.size()));
+}
+
+TEST(Hash128Tests, givenResetWhenHashIsReusedThenResultMatchesFreshHash) {
+    auto data = createTestData(100);
+
+    Hash128 hash;
+    hash.update(data.data(), 50);
+    hash.reset();
+    hash.update(data.data(), data.size());
+
+    EXPECT_EQ(Hash128::hash(data.data(), data.size()), hash.finish());
+}
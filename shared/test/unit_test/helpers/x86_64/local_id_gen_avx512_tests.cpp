@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+struct LocalIdGenAvx512Test : public ::testing::Test {
+    void SetUp() override {
+        if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512)) {
+            GTEST_SKIP();
+        }
+    }
+
+    // Lanes past the end of the work group keep counting along the walk order
+    std::vector<uint16_t> generateReferenceLocalIds(const std::array<uint16_t, 3> &lws, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder) {
+        uint32_t lwsX = lws[dimensionsOrder[0]];
+        uint32_t lwsY = lws[dimensionsOrder[1]];
+        std::vector<uint16_t> localIds(threadsPerWorkGroup * 3u * simd);
+        for (uint32_t thread = 0; thread < threadsPerWorkGroup; ++thread) {
+            auto threadIds = &localIds[thread * 3u * simd];
+            for (uint32_t lane = 0; lane < simd; ++lane) {
+                auto flattenedId = thread * simd + lane;
+                threadIds[dimensionsOrder[0] * simd + lane] = static_cast<uint16_t>(flattenedId % lwsX);
+                threadIds[dimensionsOrder[1] * simd + lane] = static_cast<uint16_t>((flattenedId / lwsX) % lwsY);
+                threadIds[dimensionsOrder[2] * simd + lane] = static_cast<uint16_t>(flattenedId / (lwsX * lwsY));
+            }
+        }
+        return localIds;
+    }
+
+    static constexpr uint32_t simd = 32u;
+};
+
+TEST_F(LocalIdGenAvx512Test, GivenAvx512SupportWhenLocalIdHelperIsInitializedThenAvx512VariantIsUsedForSimd32) {
+    auto avx512Generator = &generateLocalIDsSimd<uint16x32_t, 32>;
+    EXPECT_EQ(avx512Generator, LocalIDHelper::generateSimd32);
+}
+
+TEST_F(LocalIdGenAvx512Test, GivenVariousWorkgroupShapesWhenGeneratingSimd32LocalIdsThenResultMatchesScalarReferenceBitExactly) {
+    const std::array<uint16_t, 3> workgroupShapes[] = {
+        {{1u, 1u, 1u}}, {{7u, 3u, 2u}}, {{32u, 1u, 1u}}, {{33u, 2u, 1u}}, {{16u, 16u, 1u}},
+        {{1u, 64u, 4u}}, {{5u, 6u, 7u}}, {{256u, 4u, 1u}}, {{1024u, 1u, 1u}}, {{8u, 8u, 16u}}};
+    const std::array<uint8_t, 3> dimensionsOrders[] = {{{0u, 1u, 2u}}, {{1u, 0u, 2u}}, {{2u, 1u, 0u}}};
+
+    for (const auto &lws : workgroupShapes) {
+        for (const auto &dimensionsOrder : dimensionsOrders) {
+            auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, lws[0] * lws[1] * lws[2]));
+            auto expectedLocalIds = generateReferenceLocalIds(lws, threadsPerWorkGroup, dimensionsOrder);
+            auto size = expectedLocalIds.size() * sizeof(uint16_t);
+
+            auto buffer = alignedMalloc(size, 32);
+            memset(buffer, 0xff, size);
+            generateLocalIDsSimd<uint16x32_t, 32>(buffer, lws, threadsPerWorkGroup, dimensionsOrder, true);
+
+            EXPECT_EQ(0, memcmp(expectedLocalIds.data(), buffer, size))
+                << lws[0] << "x" << lws[1] << "x" << lws[2] << " order "
+                << static_cast<int>(dimensionsOrder[0]) << static_cast<int>(dimensionsOrder[1]) << static_cast<int>(dimensionsOrder[2]);
+            alignedFree(buffer);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,17 +7,23 @@
 
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/kernel/local_ids_cache.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <thread>
+
 struct LocalIdsCacheFixture {
     class MockLocalIdsCache : public NEO::LocalIdsCache {
       public:
         using Base = NEO::LocalIdsCache;
         using Base::Base;
         using Base::cache;
+        using Base::getReaderSlot;
+        using Base::maxReaderSlots;
+        using Base::retiredEntries;
         MockLocalIdsCache(size_t cacheSize) : Base(cacheSize, {0, 1, 2}, 32, 32, false){};
     };
 
@@ -26,48 +32,127 @@ struct LocalIdsCacheFixture {
     }
     void tearDown() {}
 
+    std::vector<uint8_t> generateExpectedLocalIds(const Vec3<uint16_t> &group) {
+        auto size = localIdsCache->getLocalIdsSizeForGroup(group);
+        auto buffer = static_cast<uint8_t *>(alignedMalloc(size, 32));
+        NEO::generateLocalIDs(buffer, 32, {group[0], group[1], group[2]}, {0, 1, 2}, false, 32);
+        std::vector<uint8_t> expected(buffer, buffer + size);
+        alignedFree(buffer);
+        return expected;
+    }
+
     std::array<uint8_t, 2048> perThreadData = {0};
     Vec3<uint16_t> groupSize = {128, 2, 1};
     std::unique_ptr<MockLocalIdsCache> localIdsCache;
 };
 
 using LocalIdsCacheTest = Test<LocalIdsCacheFixture>;
-TEST_F(LocalIdsCacheTest, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
-    localIdsCache->cache[0].accessCounter = 2U;
+TEST_F(LocalIdsCacheTest, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoEmptyEntry) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data());
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
-    EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
-    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter);
+    auto entry = localIdsCache->cache[0].entry.load();
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(nullptr, localIdsCache->cache[1].entry.load());
+    EXPECT_EQ(groupSize, entry->groupSize);
+    EXPECT_NE(nullptr, entry->localIdsData);
+    EXPECT_EQ(1536U, entry->localIdsSize);
+    EXPECT_EQ(1u, localIdsCache->getCacheMisses());
+    EXPECT_EQ(0u, localIdsCache->getCacheHits());
+
+    auto expected = generateExpectedLocalIds(groupSize);
+    EXPECT_EQ(0, memcmp(expected.data(), perThreadData.data(), expected.size()));
 }
 
 TEST_F(LocalIdsCacheTest, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 1U;
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data());
-    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter);
+    auto entry = localIdsCache->cache[0].entry.load();
+    auto lastAccess = entry->lastAccess.load();
+
+    perThreadData.fill(0);
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data());
+    EXPECT_EQ(entry, localIdsCache->cache[0].entry.load());
+    EXPECT_GT(entry->lastAccess.load(), lastAccess);
+    EXPECT_EQ(1u, localIdsCache->getCacheMisses());
+    EXPECT_EQ(1u, localIdsCache->getCacheHits());
+
+    auto expected = generateExpectedLocalIds(groupSize);
+    EXPECT_EQ(0, memcmp(expected.data(), perThreadData.data(), expected.size()));
 }
 
-TEST_F(LocalIdsCacheTest, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 2U;
-    const auto localIdsData = localIdsCache->cache[0].localIdsData;
+TEST_F(LocalIdsCacheTest, GivenFullCacheWhenGetLocalIdsForNewGroupThenLeastRecentlyUsedEntryIsReplaced) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    const Vec3<uint16_t> groupA = {16, 1, 1};
+    const Vec3<uint16_t> groupB = {32, 1, 1};
+    const Vec3<uint16_t> groupC = {64, 1, 1};
 
-    groupSize = {2, 1, 1};
-    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data());
-    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter);
-    EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
-    EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
-    EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    localIdsCache->setLocalIdsForGroup(groupA, perThreadData.data());
+    localIdsCache->setLocalIdsForGroup(groupB, perThreadData.data());
+    localIdsCache->setLocalIdsForGroup(groupA, perThreadData.data());
+    localIdsCache->setLocalIdsForGroup(groupC, perThreadData.data());
+
+    EXPECT_EQ(groupA, localIdsCache->cache[0].entry.load()->groupSize);
+    EXPECT_EQ(groupC, localIdsCache->cache[1].entry.load()->groupSize);
+    EXPECT_EQ(3u, localIdsCache->getCacheMisses());
+    EXPECT_EQ(1u, localIdsCache->getCacheHits());
+
+    auto expected = generateExpectedLocalIds(groupC);
+    EXPECT_EQ(0, memcmp(expected.data(), perThreadData.data(), expected.size()));
+}
+
+TEST_F(LocalIdsCacheTest, GivenEntryProtectedByReaderWhenEntryIsEvictedThenItIsReleasedOnlyAfterReaderClearsHazard) {
+    localIdsCache->setLocalIdsForGroup({16, 1, 1}, perThreadData.data());
+    auto readerSlot = localIdsCache->getReaderSlot();
+    ASSERT_NE(nullptr, readerSlot);
+
+    readerSlot->hazard.store(localIdsCache->cache[0].entry.load());
+    localIdsCache->setLocalIdsForGroup({32, 1, 1}, perThreadData.data());
+    EXPECT_EQ(1u, localIdsCache->retiredEntries.size());
+    readerSlot->hazard.store(nullptr);
+
+    localIdsCache->setLocalIdsForGroup({64, 1, 1}, perThreadData.data());
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+}
+
+TEST_F(LocalIdsCacheTest, GivenManyEvictionsWhenGetLocalIdsForGroupThenRetiredEntriesStayBoundedByReaderSlots) {
+    for (uint16_t i = 1; i <= 64; i++) {
+        localIdsCache->setLocalIdsForGroup({i, 1, 1}, perThreadData.data());
+        EXPECT_LE(localIdsCache->retiredEntries.size(), MockLocalIdsCache::maxReaderSlots);
+    }
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+    EXPECT_EQ(64u, localIdsCache->getCacheMisses());
+}
+
+TEST_F(LocalIdsCacheTest, GivenConcurrentLaunchesWithVaryingGroupSizesWhenGetLocalIdsForGroupThenCorrectLocalIdsAreReturned) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    const std::array<Vec3<uint16_t>, 4> groups = {{{16, 1, 1}, {8, 4, 1}, {32, 2, 1}, {4, 4, 4}}};
+    std::array<std::vector<uint8_t>, 4> expected;
+    for (size_t i = 0; i < groups.size(); i++) {
+        expected[i] = generateExpectedLocalIds(groups[i]);
+    }
+
+    std::atomic<uint32_t> mismatches{0u};
+    auto launch = [&](size_t threadId) {
+        std::array<uint8_t, 2048> data;
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            auto groupId = (iteration + threadId) % groups.size();
+            localIdsCache->setLocalIdsForGroup(groups[groupId], data.data());
+            if (memcmp(expected[groupId].data(), data.data(), expected[groupId].size()) != 0) {
+                mismatches++;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t threadId = 0; threadId < 4; threadId++) {
+        threads.emplace_back(launch, threadId);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, mismatches);
+    EXPECT_EQ(800u, localIdsCache->getCacheHits() + localIdsCache->getCacheMisses());
 }
 
 TEST_F(LocalIdsCacheTest, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
@@ -326,3 +326,166 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingReusableAllocationThenSmallestFittingAllocationIsReturned) {
+    *csr->getTagAddress() = 0u;
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto mediumAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 4 * MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(mediumAllocation), REUSABLE_ALLOCATION);
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    EXPECT_EQ(bigAllocation->getUnderlyingBufferSize() + smallAllocation->getUnderlyingBufferSize() + mediumAllocation->getUnderlyingBufferSize(), reusableAllocations.getTotalSize());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, AllocationType::BUFFER);
+    EXPECT_EQ(mediumAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::INTERNAL_HEAP);
+    EXPECT_EQ(nullptr, reusedAllocation.get());
+
+    EXPECT_TRUE(reusableAllocations.peekContains(*bigAllocation));
+    EXPECT_EQ(bigAllocation->getUnderlyingBufferSize(), reusableAllocations.getTotalSize());
+    EXPECT_EQ(2u, reusableAllocations.getReuseStatistics().hits);
+    EXPECT_EQ(1u, reusableAllocations.getReuseStatistics().misses);
+
+    reusableAllocations.freeAllGraphicsAllocations(device.get());
+    EXPECT_EQ(0u, reusableAllocations.getTotalSize());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsRemovedFromListWhenObtainingReusableAllocationThenRemovedAllocationsAreNotReturned) {
+    *csr->getTagAddress() = 0u;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    auto removedAllocation = reusableAllocations.removeOne(*allocation);
+    EXPECT_EQ(allocation2->getUnderlyingBufferSize(), reusableAllocations.getTotalSize());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(allocation2, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+
+    reusableAllocations.pushTailOne(*removedAllocation.release());
+    reusableAllocations.pushTailOne(*reusedAllocation.release());
+    storage->cleanAllocationList(0u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(reusableAllocations.peekIsEmpty());
+    EXPECT_EQ(0u, reusableAllocations.getTotalSize());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsMaxTotalSizeWhenStoringReusableAllocationsAboveLimitThenOldestCompletedAllocationsAreReleased) {
+    *csr->getTagAddress() = 1u;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation3 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    const auto allocationSize = allocation->getUnderlyingBufferSize();
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ReusableAllocationsMaxTotalSize.set(2 * allocationSize);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 2u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    EXPECT_EQ(2 * allocationSize, reusableAllocations.getTotalSize());
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+    EXPECT_TRUE(reusableAllocations.peekContains(*busyAllocation));
+    EXPECT_FALSE(reusableAllocations.peekContains(*allocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*allocation2));
+    EXPECT_EQ(2 * allocationSize, reusableAllocations.getTotalSize());
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation3), REUSABLE_ALLOCATION, 1u);
+    EXPECT_TRUE(reusableAllocations.peekContains(*busyAllocation));
+    EXPECT_FALSE(reusableAllocations.peekContains(*allocation2));
+    EXPECT_TRUE(reusableAllocations.peekContains(*allocation3));
+
+    EXPECT_EQ(2u, reusableAllocations.getReuseStatistics().evictedAllocations);
+    EXPECT_EQ(2 * allocationSize, reusableAllocations.getReuseStatistics().evictedBytes);
+
+    *csr->getTagAddress() = 2u;
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+}
+
+HWTEST_F(InternalAllocationStorageTest, givenReusableAllocationsMaxAgeWhenStoringReusableAllocationThenCompletedAllocationsNotReusedForLongerAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ReusableAllocationsMaxAge.set(2);
+    auto ultCsr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> *>(csr);
+    *csr->getTagAddress() = 10u;
+
+    auto oldAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto recentAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto newAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+
+    ultCsr->taskCount = 5u;
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(oldAllocation), REUSABLE_ALLOCATION);
+    ultCsr->taskCount = 6u;
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(recentAllocation), REUSABLE_ALLOCATION);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    EXPECT_TRUE(reusableAllocations.peekContains(*oldAllocation));
+
+    ultCsr->taskCount = 8u;
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(newAllocation), REUSABLE_ALLOCATION);
+    EXPECT_FALSE(reusableAllocations.peekContains(*oldAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*recentAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*newAllocation));
+    EXPECT_EQ(1u, reusableAllocations.getReuseStatistics().evictedAllocations);
+
+    ultCsr->taskCount = 0u;
+    storage->cleanAllocationList(10u, REUSABLE_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsMaxTotalSizeAndAllocationWithAssignedHostPtrTaskCountWhenEvictingThenItIsNotReleased) {
+    *csr->getTagAddress() = 1u;
+    auto assignedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    const auto allocationSize = allocation->getUnderlyingBufferSize();
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ReusableAllocationsMaxTotalSize.set(allocationSize);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    assignedAllocation->hostPtrTaskCountAssignment = 1;
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(assignedAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+
+    EXPECT_TRUE(reusableAllocations.peekContains(*assignedAllocation));
+    EXPECT_FALSE(reusableAllocations.peekContains(*allocation));
+    EXPECT_EQ(1u, reusableAllocations.getReuseStatistics().evictedAllocations);
+
+    assignedAllocation->hostPtrTaskCountAssignment = 0;
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(reusableAllocations.peekIsEmpty());
+}
+
+HWTEST_F(InternalAllocationStorageTest, givenReusableAllocationsMaxAgeWhenEvictingThenWalkStopsAtFirstAllocationYoungerThanLimit) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ReusableAllocationsMaxAge.set(2);
+    auto ultCsr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> *>(csr);
+    *csr->getTagAddress() = 10u;
+    ultCsr->taskCount = 10u;
+
+    auto youngAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto oldAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(youngAllocation), REUSABLE_ALLOCATION, 9u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(oldAllocation), REUSABLE_ALLOCATION, 5u);
+
+    EXPECT_TRUE(reusableAllocations.peekContains(*youngAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*oldAllocation));
+    EXPECT_EQ(0u, reusableAllocations.getReuseStatistics().evictedAllocations);
+
+    ultCsr->taskCount = 0u;
+    storage->cleanAllocationList(10u, REUSABLE_ALLOCATION);
+}
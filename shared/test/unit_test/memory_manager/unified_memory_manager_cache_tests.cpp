@@ -25,6 +25,8 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnab
     auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
     ASSERT_EQ(DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get(), -1);
     EXPECT_FALSE(svmManager->usmDeviceAllocationsCacheEnabled);
+    EXPECT_FALSE(svmManager->usmHostAllocationsCacheEnabled);
+    EXPECT_FALSE(svmManager->usmSharedAllocationsCacheEnabled);
 }
 
 struct SvmDeviceAllocationCacheSimpleTestDataType {
@@ -65,8 +67,8 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         svmManager->freeSVMAlloc(testData.allocation);
         EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache.allocations[i].allocation == testData.allocation) {
+        for (auto &cachedAllocation : svmManager->usmDeviceAllocationsCache.allocations) {
+            if (cachedAllocation.allocation == testData.allocation) {
                 foundInCache = true;
                 break;
             }
@@ -130,7 +132,7 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
 }
 
-TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
+TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallestWithinNextSizeClass) {
     std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
     RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
     std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
@@ -176,8 +178,8 @@ TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
-    EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_NE(thirdAllocation, testDataset[2].allocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -313,3 +315,193 @@ TEST(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCache
     svmManager->trimUSMDeviceAllocCache();
     ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
 }
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenAllocationsDifferInSizeClassThenOnlyNextSizeClassIsReused) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    EXPECT_EQ(SVMAllocsManager::SvmAllocationCache::getSizeClass(MemoryConstants::pageSize64k), SVMAllocsManager::SvmAllocationCache::getSizeClass((MemoryConstants::pageSize64k << 1) - 1));
+    EXPECT_NE(SVMAllocsManager::SvmAllocationCache::getSizeClass(MemoryConstants::pageSize64k), SVMAllocsManager::SvmAllocationCache::getSizeClass(MemoryConstants::pageSize64k << 1));
+    EXPECT_EQ(0u, SVMAllocsManager::SvmAllocationCache::getSizeClass(0u));
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto largeAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k << 4, unifiedMemoryProperties);
+    ASSERT_NE(largeAllocation, nullptr);
+    svmManager->freeSVMAlloc(largeAllocation);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+
+    auto smallAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_NE(smallAllocation, largeAllocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+
+    auto nextSizeClassAllocation = svmManager->createUnifiedMemoryAllocation((MemoryConstants::pageSize64k << 3) + 1, unifiedMemoryProperties);
+    EXPECT_EQ(nextSizeClassAllocation, largeAllocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), 0u);
+
+    svmManager->freeSVMAlloc(smallAllocation);
+    svmManager->freeSVMAlloc(nextSizeClassAllocation);
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheMaxSizeWhenCacheIsFullThenOldestAllocationsAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.ExperimentalAllocationCacheMaxSize.set(MemoryConstants::pageSize64k * 2);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.maxSize, MemoryConstants::pageSize64k * 2);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    void *allocations[3] = {};
+    for (auto &allocation : allocations) {
+        allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+        ASSERT_NE(allocation, nullptr);
+    }
+    for (auto &allocation : allocations) {
+        svmManager->freeSVMAlloc(allocation);
+    }
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), MemoryConstants::pageSize64k * 2);
+    EXPECT_EQ(svmManager->getSVMAlloc(allocations[0]), nullptr);
+    EXPECT_NE(svmManager->getSVMAlloc(allocations[1]), nullptr);
+    EXPECT_NE(svmManager->getSVMAlloc(allocations[2]), nullptr);
+
+    auto tooLargeAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 3, unifiedMemoryProperties);
+    ASSERT_NE(tooLargeAllocation, nullptr);
+    svmManager->freeSVMAlloc(tooLargeAllocation);
+    EXPECT_EQ(svmManager->getSVMAlloc(tooLargeAllocation), nullptr);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), 0u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheMaxAgeWhenAllocationIsHeldLongerThenItIsReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.ExperimentalAllocationCacheMaxAge.set(1000);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.maxAge, std::chrono::milliseconds(1000));
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+
+    auto insertTime = svmManager->usmDeviceAllocationsCache.allocations.front().insertTime;
+    svmManager->usmDeviceAllocationsCache.trimOldAllocations(insertTime + std::chrono::milliseconds(1000), svmManager.get());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+    EXPECT_NE(svmManager->getSVMAlloc(allocation), nullptr);
+
+    svmManager->usmDeviceAllocationsCache.trimOldAllocations(insertTime + std::chrono::milliseconds(1001), svmManager.get());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getCachedSize(), 0u);
+    EXPECT_EQ(svmManager->getSVMAlloc(allocation), nullptr);
+}
+
+TEST(SvmHostAllocationCacheTest, givenHostAllocationCacheEnabledWhenAllocatingAfterFreeThenReturnCachedAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+    ASSERT_FALSE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 1u);
+    EXPECT_NE(svmManager->getSVMAlloc(allocation), nullptr);
+
+    unifiedMemoryProperties.allocationFlags.flags.writeOnly = true;
+    auto allocationWithDifferentFlags = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    EXPECT_NE(allocationWithDifferentFlags, allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 1u);
+
+    unifiedMemoryProperties.allocationFlags.flags.writeOnly = false;
+    auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize, unifiedMemoryProperties);
+    EXPECT_EQ(allocationFromCache, allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->freeSVMAlloc(allocationWithDifferentFlags);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 2u);
+    svmManager->trimUSMAllocCaches();
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->getNumAllocs(), 0u);
+}
+
+TEST(SvmSharedAllocationCacheTest, givenSharedAllocationCacheEnabledAndSingleStorageSharedAllocationWhenAllocatingAfterFreeThenReturnCachedAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableSharedAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmSharedAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(allocation, nullptr);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.allocations.size(), 1u);
+
+    auto allocationFromCache = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    EXPECT_EQ(allocationFromCache, allocation);
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.allocations.size(), 0u);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMSharedAllocCache();
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->getNumAllocs(), 0u);
+}
+
+TEST(SvmSharedAllocationCacheTest, givenSharedAllocationCacheEnabledWhenFreeingAllocationWithCpuStorageThenItIsNotCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableSharedAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmSharedAllocationsCacheEnabled);
+
+    MockGraphicsAllocation cpuAllocation;
+    MockGraphicsAllocation gpuAllocation;
+    SvmAllocationData svmData(mockRootDeviceIndex);
+    svmData.cpuAllocation = &cpuAllocation;
+    svmData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmData.memoryType = InternalMemoryType::SHARED_UNIFIED_MEMORY;
+    svmData.size = MemoryConstants::pageSize64k;
+    svmData.device = device;
+    EXPECT_FALSE(svmManager->insertIntoUsmAllocationsCache(reinterpret_cast<void *>(gpuAllocation.getGpuAddress()), &svmData));
+
+    svmData.cpuAllocation = nullptr;
+    svmData.isImportedAllocation = true;
+    EXPECT_FALSE(svmManager->insertIntoUsmAllocationsCache(reinterpret_cast<void *>(gpuAllocation.getGpuAddress()), &svmData));
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.allocations.size(), 0u);
+}
@@ -36,6 +36,115 @@ TEST(SvmDeviceAllocationTest, givenGivenSvmAllocsManagerWhenObtainOwnershipCalle
     th2.join();
 }
 
+TEST(SvmAllocationLookupTest, givenCachedLookupWhenAllocationIsRemovedAndAnotherInsertedAtSameAddressThenNewDataIsReturned) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    void *gpuPtr = reinterpret_cast<void *>(0x10000);
+    MockGraphicsAllocation mockAllocation(gpuPtr, 0x1000u);
+    SvmAllocationData allocationData(1u);
+    allocationData.size = 0x1000u;
+    allocationData.gpuAllocations.addAllocation(&mockAllocation);
+    svmManager->insertSVMAlloc(allocationData);
+
+    auto svmData = svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x10));
+    ASSERT_NE(nullptr, svmData);
+    EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x20)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x1000)));
+
+    svmManager->removeSVMAlloc(allocationData);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x10)));
+
+    SvmAllocationData smallerAllocationData(1u);
+    smallerAllocationData.size = 0x100u;
+    smallerAllocationData.gpuAllocations.addAllocation(&mockAllocation);
+    svmManager->insertSVMAlloc(smallerAllocationData);
+
+    svmData = svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x10));
+    ASSERT_NE(nullptr, svmData);
+    EXPECT_EQ(0x100u, svmData->size);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(gpuPtr, 0x200)));
+
+    svmManager->removeSVMAlloc(smallerAllocationData);
+}
+
+TEST(SvmAllocationLookupTest, givenLookupCachedByOneSvmManagerWhenOtherManagerIsQueriedThenItsOwnAllocationsAreReturned) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto otherSvmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    void *gpuPtr = reinterpret_cast<void *>(0x10000);
+    MockGraphicsAllocation mockAllocation(gpuPtr, 0x1000u);
+    SvmAllocationData allocationData(1u);
+    allocationData.size = 0x1000u;
+    allocationData.gpuAllocations.addAllocation(&mockAllocation);
+    svmManager->insertSVMAlloc(allocationData);
+
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(gpuPtr));
+    EXPECT_EQ(nullptr, otherSvmManager->getSVMAlloc(gpuPtr));
+
+    svmManager->removeSVMAlloc(allocationData);
+}
+
+TEST(SvmAllocationLookupTest, givenConcurrentReadersAndWriterWhenLookingUpAllocationsThenEachReaderGetsTrackedData) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    constexpr size_t numAllocations = 8u;
+    constexpr size_t allocationSize = 0x1000u;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> mockAllocations;
+    for (size_t i = 0; i < numAllocations; i++) {
+        mockAllocations.push_back(std::make_unique<MockGraphicsAllocation>(reinterpret_cast<void *>(0x100000 + i * 0x10000), allocationSize));
+        SvmAllocationData allocationData(1u);
+        allocationData.size = allocationSize;
+        allocationData.gpuAllocations.addAllocation(mockAllocations.back().get());
+        svmManager->insertSVMAlloc(allocationData);
+    }
+    MockGraphicsAllocation transientAllocation(reinterpret_cast<void *>(0x900000), allocationSize);
+    SvmAllocationData transientAllocationData(1u);
+    transientAllocationData.size = allocationSize;
+    transientAllocationData.gpuAllocations.addAllocation(&transientAllocation);
+
+    std::atomic<bool> readersDone = false;
+    std::atomic<uint32_t> mismatches = 0u;
+    std::vector<std::thread> readers;
+    for (uint32_t thread = 0; thread < 4u; thread++) {
+        readers.emplace_back([&, thread] {
+            for (uint32_t iteration = 0; iteration < 2000u; iteration++) {
+                auto &mockAllocation = mockAllocations[(iteration + thread) % numAllocations];
+                auto ptr = ptrOffset(mockAllocation->getUnderlyingBuffer(), iteration % allocationSize);
+                auto svmData = svmManager->getSVMAlloc(ptr);
+                if (svmData == nullptr || svmData->gpuAllocations.getDefaultGraphicsAllocation() != mockAllocation.get()) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    std::thread writer([&] {
+        while (!readersDone) {
+            svmManager->insertSVMAlloc(transientAllocationData);
+            svmManager->removeSVMAlloc(transientAllocationData);
+        }
+    });
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    readersDone = true;
+    writer.join();
+
+    EXPECT_EQ(0u, mismatches);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(transientAllocation.getUnderlyingBuffer()));
+    EXPECT_EQ(numAllocations, svmManager->getNumAllocs());
+    for (auto &mockAllocation : mockAllocations) {
+        auto svmData = svmManager->getSVMAlloc(mockAllocation->getUnderlyingBuffer());
+        ASSERT_NE(nullptr, svmData);
+        svmManager->removeSVMAlloc(*svmData);
+    }
+}
+
 using SVMLocalMemoryAllocatorTest = Test<SVMMemoryAllocatorFixture<true>>;
 TEST_F(SVMLocalMemoryAllocatorTest, whenFreeSharedAllocWithOffsetPointerThenResourceIsRemovedProperly) {
     DebugManagerStateRestore restore;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+struct MockUsmMemAllocPool : public UsmMemAllocPool {
+    using UsmMemAllocPool::allocations;
+    using UsmMemAllocPool::chunkAllocator;
+    using UsmMemAllocPool::pool;
+    using UsmMemAllocPool::poolEnd;
+    using UsmMemAllocPool::pooledAllocData;
+};
+
+class UnifiedMemoryPoolingTest : public ::testing::TestWithParam<InternalMemoryType> {
+  public:
+    void SetUp() override {
+        deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+        device = deviceFactory->rootDevices[0];
+        svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+        poolMemoryProperties = std::make_unique<SVMAllocsManager::UnifiedMemoryProperties>(GetParam(), rootDeviceIndices, deviceBitfields);
+        if (GetParam() == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
+            poolMemoryProperties->device = device;
+        }
+        usmMemAllocPool = std::make_unique<MockUsmMemAllocPool>();
+        ASSERT_TRUE(usmMemAllocPool->initialize(svmManager.get(), *poolMemoryProperties, poolSize));
+    }
+
+    void TearDown() override {
+        usmMemAllocPool.reset();
+    }
+
+    static constexpr size_t poolSize = 2 * MemoryConstants::megaByte;
+    std::unique_ptr<UltDeviceFactory> deviceFactory;
+    Device *device = nullptr;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::unique_ptr<MockUsmMemAllocPool> usmMemAllocPool;
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    std::unique_ptr<SVMAllocsManager::UnifiedMemoryProperties> poolMemoryProperties;
+};
+
+INSTANTIATE_TEST_CASE_P(UnifiedMemoryPoolingTestParameterized,
+                        UnifiedMemoryPoolingTest,
+                        ::testing::Values(InternalMemoryType::DEVICE_UNIFIED_MEMORY, InternalMemoryType::HOST_UNIFIED_MEMORY));
+
+TEST_P(UnifiedMemoryPoolingTest, givenInitializedPoolThenBackingAllocationIsTrackedBySvmManager) {
+    EXPECT_TRUE(usmMemAllocPool->isInitialized());
+    EXPECT_EQ(poolSize, usmMemAllocPool->getPoolSize());
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+    EXPECT_EQ(svmManager->getSVMAlloc(usmMemAllocPool->pool), usmMemAllocPool->pooledAllocData);
+    EXPECT_EQ(GetParam(), usmMemAllocPool->pooledAllocData->memoryType);
+
+    usmMemAllocPool->cleanup();
+    EXPECT_FALSE(usmMemAllocPool->isInitialized());
+    EXPECT_EQ(0u, usmMemAllocPool->getPoolSize());
+    EXPECT_EQ(nullptr, usmMemAllocPool->pooledAllocData);
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenSmallAllocationWhenAllocatingFromPoolThenInteriorPointerOfBackingAllocationIsReturned) {
+    auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_TRUE(usmMemAllocPool->isInPool(ptr));
+    EXPECT_TRUE(isAligned<UsmMemAllocPool::chunkAlignment>(ptr));
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+
+    EXPECT_EQ(usmMemAllocPool->pooledAllocData, svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(ptr, usmMemAllocPool->getPooledAllocationBasePtr(ptr));
+    EXPECT_EQ(1u, usmMemAllocPool->getPooledAllocationSize(ptr));
+    EXPECT_EQ(UsmMemAllocPool::chunkAlignment, usmMemAllocPool->getUsedSize());
+
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(ptr, false));
+    EXPECT_EQ(0u, usmMemAllocPool->getUsedSize());
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenPointerInsidePooledAllocationWhenQueryingThenBaseAndSizeOfPooledAllocationAreReturned) {
+    constexpr size_t allocationSize = 3 * MemoryConstants::kiloByte;
+    auto first = usmMemAllocPool->createUnifiedMemoryAllocation(allocationSize, 0u, *poolMemoryProperties);
+    auto second = usmMemAllocPool->createUnifiedMemoryAllocation(allocationSize, 0u, *poolMemoryProperties);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+
+    auto interiorPtr = ptrOffset(second, allocationSize - 1);
+    EXPECT_EQ(second, usmMemAllocPool->getPooledAllocationBasePtr(interiorPtr));
+    EXPECT_EQ(allocationSize, usmMemAllocPool->getPooledAllocationSize(interiorPtr));
+    EXPECT_EQ(usmMemAllocPool->pooledAllocData, svmManager->getSVMAlloc(interiorPtr));
+
+    EXPECT_FALSE(usmMemAllocPool->freeSVMAlloc(interiorPtr, false));
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(second, false));
+    EXPECT_EQ(nullptr, usmMemAllocPool->getPooledAllocationBasePtr(interiorPtr));
+    EXPECT_EQ(0u, usmMemAllocPool->getPooledAllocationSize(interiorPtr));
+    EXPECT_FALSE(usmMemAllocPool->freeSVMAlloc(second, false));
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(first, false));
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenRequestNotMatchingPoolWhenAllocatingThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(0u, 0u, *poolMemoryProperties));
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(UsmMemAllocPool::allocationThreshold + 1, 0u, *poolMemoryProperties));
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 3u, *poolMemoryProperties));
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 2 * UsmMemAllocPool::maxAlignment, *poolMemoryProperties));
+
+    auto otherMemoryType = GetParam() == InternalMemoryType::HOST_UNIFIED_MEMORY ? InternalMemoryType::DEVICE_UNIFIED_MEMORY : InternalMemoryType::HOST_UNIFIED_MEMORY;
+    SVMAllocsManager::UnifiedMemoryProperties otherTypeProperties(otherMemoryType, rootDeviceIndices, deviceBitfields);
+    otherTypeProperties.device = poolMemoryProperties->device;
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, otherTypeProperties));
+
+    SVMAllocsManager::UnifiedMemoryProperties uncachedProperties(GetParam(), rootDeviceIndices, deviceBitfields);
+    uncachedProperties.device = poolMemoryProperties->device;
+    uncachedProperties.allocationFlags.flags.locallyUncachedResource = 1;
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, uncachedProperties));
+
+    EXPECT_EQ(0u, usmMemAllocPool->getUsedSize());
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenCustomAlignmentWhenAllocatingFromPoolThenReturnedPointerIsAligned) {
+    auto unaligned = usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties);
+    auto aligned = usmMemAllocPool->createUnifiedMemoryAllocation(1u, MemoryConstants::pageSize64k, *poolMemoryProperties);
+    ASSERT_NE(nullptr, unaligned);
+    ASSERT_NE(nullptr, aligned);
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize64k>(aligned));
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(aligned, false));
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(unaligned, false));
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenExhaustedPoolWhenAllocatingThenNullptrIsReturnedUntilAllocationIsFreed) {
+    std::vector<void *> pooledPtrs;
+    for (size_t i = 0; i < poolSize / UsmMemAllocPool::allocationThreshold; i++) {
+        auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(UsmMemAllocPool::allocationThreshold, 0u, *poolMemoryProperties);
+        ASSERT_NE(nullptr, ptr);
+        pooledPtrs.push_back(ptr);
+    }
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties));
+
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(pooledPtrs.back(), true));
+    pooledPtrs.pop_back();
+    auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties);
+    EXPECT_NE(nullptr, ptr);
+    pooledPtrs.push_back(ptr);
+
+    for (auto pooledPtr : pooledPtrs) {
+        EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(pooledPtr, false));
+    }
+    EXPECT_EQ(0u, usmMemAllocPool->getUsedSize());
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenPoolInUseWhenDeferFreeingThenChunkIsReleasedOnlyAfterPoolIsIdle) {
+    auto mockMemoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(MemoryConstants::pageSize, 0u, *poolMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto usedSize = usmMemAllocPool->getUsedSize();
+
+    mockMemoryManager->deferAllocInUse = true;
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAllocDefer(ptr));
+    EXPECT_FALSE(usmMemAllocPool->freeSVMAllocDefer(ptr));
+    EXPECT_EQ(nullptr, usmMemAllocPool->getPooledAllocationBasePtr(ptr));
+    EXPECT_EQ(1u, usmMemAllocPool->getNumDeferredChunks());
+    EXPECT_EQ(usedSize, usmMemAllocPool->getUsedSize());
+
+    usmMemAllocPool->freeSVMAllocDeferImpl();
+    EXPECT_EQ(1u, usmMemAllocPool->getNumDeferredChunks());
+
+    mockMemoryManager->deferAllocInUse = false;
+    usmMemAllocPool->freeSVMAllocDeferImpl();
+    EXPECT_EQ(0u, usmMemAllocPool->getNumDeferredChunks());
+    EXPECT_EQ(0u, usmMemAllocPool->getUsedSize());
+}
+
+TEST_P(UnifiedMemoryPoolingTest, givenExhaustedPoolWithDeferredChunksWhenAllocatingThenIdleDeferredChunksAreReused) {
+    auto mockMemoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    std::vector<void *> pooledPtrs;
+    for (size_t i = 0; i < poolSize / UsmMemAllocPool::allocationThreshold; i++) {
+        auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(UsmMemAllocPool::allocationThreshold, 0u, *poolMemoryProperties);
+        ASSERT_NE(nullptr, ptr);
+        pooledPtrs.push_back(ptr);
+    }
+
+    mockMemoryManager->deferAllocInUse = true;
+    EXPECT_TRUE(usmMemAllocPool->freeSVMAllocDefer(pooledPtrs.back()));
+    pooledPtrs.pop_back();
+    EXPECT_EQ(nullptr, usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties));
+
+    mockMemoryManager->deferAllocInUse = false;
+    auto ptr = usmMemAllocPool->createUnifiedMemoryAllocation(1u, 0u, *poolMemoryProperties);
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_EQ(0u, usmMemAllocPool->getNumDeferredChunks());
+    pooledPtrs.push_back(ptr);
+
+    for (auto pooledPtr : pooledPtrs) {
+        EXPECT_TRUE(usmMemAllocPool->freeSVMAlloc(pooledPtr, false));
+    }
+    EXPECT_EQ(0u, usmMemAllocPool->getUsedSize());
+}
+
+TEST(UnifiedMemoryPoolingStandaloneTest, givenUninitializedPoolThenNothingIsPooled) {
+    UsmMemAllocPool usmMemAllocPool;
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+
+    EXPECT_FALSE(usmMemAllocPool.isInitialized());
+    EXPECT_EQ(nullptr, usmMemAllocPool.createUnifiedMemoryAllocation(1u, 0u, memoryProperties));
+    EXPECT_FALSE(usmMemAllocPool.isInPool(nullptr));
+    EXPECT_FALSE(usmMemAllocPool.freeSVMAlloc(reinterpret_cast<void *>(0x1000), false));
+    EXPECT_EQ(0u, usmMemAllocPool.getUsedSize());
+    usmMemAllocPool.cleanup();
+}
+
+TEST(UnifiedMemoryPoolingStandaloneTest, givenSharedOrHostPtrPropertiesWhenInitializingPoolThenItFails) {
+    auto deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(deviceFactory->rootDevices[0]->getMemoryManager(), false);
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+
+    UsmMemAllocPool usmMemAllocPool;
+    SVMAllocsManager::UnifiedMemoryProperties sharedProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    EXPECT_FALSE(usmMemAllocPool.initialize(svmManager.get(), sharedProperties, MemoryConstants::megaByte));
+
+    SVMAllocsManager::UnifiedMemoryProperties hostPtrProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    hostPtrProperties.allocationFlags.hostptr = 0x1000;
+    EXPECT_FALSE(usmMemAllocPool.initialize(svmManager.get(), hostPtrProperties, MemoryConstants::megaByte));
+    EXPECT_FALSE(usmMemAllocPool.isInitialized());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
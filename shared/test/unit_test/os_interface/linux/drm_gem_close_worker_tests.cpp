@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -26,6 +27,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -165,24 +167,135 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::workQueues;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
-    EXPECT_NE(nullptr, worker->thread);
+    EXPECT_NE(nullptr, worker->workQueues[0]->thread);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_EQ(nullptr, worker->workQueues[0]->thread);
 }
 
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::workQueues;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
     worker->close(true);
     worker->close(true);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_EQ(nullptr, worker->workQueues[0]->thread);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenThreadsCountDebugFlagWhenWorkerIsCreatedThenThreadsCountIsOverriddenAndClamped) {
+    DebugManagerStateRestore restore;
+
+    DrmGemCloseWorker defaultWorker(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::defaultThreadsCount, defaultWorker.getThreadsCount());
+
+    DrmGemCloseWorker explicitWorker(*mm, 2u);
+    EXPECT_EQ(2u, explicitWorker.getThreadsCount());
+
+    DebugManager.flags.GemCloseWorkerThreadsCount.set(3);
+    DrmGemCloseWorker overriddenWorker(*mm, 2u);
+    EXPECT_EQ(3u, overriddenWorker.getThreadsCount());
+
+    DebugManager.flags.GemCloseWorkerThreadsCount.set(1000);
+    DrmGemCloseWorker clampedWorker(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::maxThreadsCount, clampedWorker.getThreadsCount());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleWorkerThreadsWhenManyBufferObjectsArePushedFromMultipleThreadsThenAllAreClosed) {
+    constexpr int numProducers = 4;
+    constexpr int bosPerProducer = 256;
+    this->drmMock->gem_close_expected = numProducers * bosPerProducer;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm, 4u);
+    EXPECT_EQ(4u, worker->getThreadsCount());
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numProducers; producer++) {
+        producers.emplace_back([&]() {
+            for (int i = 0; i < bosPerProducer; i++) {
+                worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    auto progress = worker->getProgress();
+    EXPECT_EQ(static_cast<uint64_t>(numProducers * bosPerProducer), progress.pushedCount);
+    EXPECT_EQ(progress.pushedCount, progress.closedCount);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenRunningWorkerThreadsWhenTryDrainIsCalledThenPendingBufferObjectsAreClosedByWorkers) {
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+    worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+
+    while (!worker->tryDrain() && (deadCnt-- > 0)) {
+        sched_yield();
+    }
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_NE(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+
+    auto progress = worker->getProgress();
+    EXPECT_EQ(2u, progress.pushedCount);
+    EXPECT_EQ(2u, progress.closedCount);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenStoppedWorkerThreadsWhenTryDrainIsCalledThenPendingBufferObjectsAreNotClosedOnCallingThread) {
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    worker->close(true);
+
+    worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+    worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+
+    EXPECT_FALSE(worker->tryDrain());
+    EXPECT_EQ(0, this->drmMock->gem_close_cnt.load());
+
+    auto progress = worker->getProgress();
+    EXPECT_EQ(2u, progress.pushedCount);
+    EXPECT_EQ(0u, progress.closedCount);
+    EXPECT_FALSE(worker->isEmpty());
+
+    worker.reset();
+    EXPECT_EQ(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectPushedAgainBeforeItIsClosedWhenQueueIsDrainedThenItIsClosedOncePerPush) {
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::drainOnCallingThread;
+    };
+    this->drmMock->gem_close_expected = 1;
+
+    auto worker = std::make_unique<MockDrmGemCloseWorker>(*mm);
+    worker->close(true);
+
+    auto bo = new BufferObject(this->drmMock, 3, 1, 0, 1);
+    bo->reference();
+    worker->push(bo);
+    worker->push(bo);
+
+    EXPECT_EQ(2u, bo->getGemCloseNode().pendingCloses.load());
+    EXPECT_EQ(nullptr, bo->getGemCloseNode().next);
+
+    worker->drainOnCallingThread();
+
+    auto progress = worker->getProgress();
+    EXPECT_EQ(2u, progress.pushedCount);
+    EXPECT_EQ(2u, progress.closedCount);
+    EXPECT_TRUE(worker->isEmpty());
 }
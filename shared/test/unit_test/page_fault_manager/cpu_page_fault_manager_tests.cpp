@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -365,6 +365,145 @@ TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProper
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocsWhenVerifyingPageFaultAtAnyOffsetThenOwningAllocIsFound) {
+    constexpr size_t allocSize = 0x100;
+    constexpr size_t allocStride = 0x200;
+    constexpr size_t allocsCount = 1000;
+    auto getAlloc = [](size_t index) { return reinterpret_cast<void *>(allocStride * (index + 1)); };
+
+    for (size_t index = 0; index < allocsCount; index++) {
+        pageFaultManager->insertAllocation(getAlloc(index), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+    EXPECT_EQ(allocsCount, pageFaultManager->memoryData.size());
+
+    for (size_t index : {size_t(0), allocsCount / 2, allocsCount - 1}) {
+        EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(getAlloc(index), allocSize - 1)));
+        EXPECT_EQ(getAlloc(index), pageFaultManager->allowedMemoryAccessAddress);
+        EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+
+        EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(getAlloc(index), allocSize)));
+    }
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(allocStride - 1)));
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(3u, statistics.pageFaults);
+    EXPECT_EQ(4u, statistics.unhandledPageFaults);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocMigratedBetweenDomainsWhenGettingStatisticsThenTransfersAreCounted) {
+    void *alloc1 = reinterpret_cast<void *>(0x1);
+    void *alloc2 = reinterpret_cast<void *>(0x100);
+
+    pageFaultManager->insertAllocation(alloc1, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 20, unifiedMemoryManager.get(), nullptr, {});
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(0u, statistics.transfersToGpu);
+    EXPECT_EQ(0u, statistics.transfersToCpu);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    pageFaultManager->verifyPageFault(alloc2);
+
+    statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(1u, statistics.pageFaults);
+    EXPECT_EQ(2u, statistics.transfersToGpu);
+    EXPECT_EQ(30u, statistics.bytesTransferredToGpu);
+    EXPECT_EQ(1u, statistics.transfersToCpu);
+    EXPECT_EQ(20u, statistics.bytesTransferredToCpu);
+    EXPECT_LE(statistics.maxTransferToGpuTimeNs, statistics.transferToGpuTimeNs);
+    EXPECT_LE(statistics.maxTransferToCpuTimeNs, statistics.transferToCpuTimeNs);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedMigrationWhenVerifyingSparsePageFaultsThenOnlyTouchedChunksAreTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    DebugManager.flags.UsmSharedMigrationPrefetchChunks.set(0);
+
+    constexpr size_t allocSize = MemoryConstants::megaByte;
+    constexpr size_t chunkSize = MemoryConstants::pageSize64k;
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(chunkSize, pageFaultManager->memoryData[alloc].migrationChunkSize);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+
+    for (size_t faultOffset : {size_t(0x1000), 5 * chunkSize + 0x10, allocSize - 1}) {
+        EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, faultOffset)));
+        auto chunkPtr = ptrOffset(alloc, faultOffset - faultOffset % chunkSize);
+        EXPECT_EQ(chunkPtr, pageFaultManager->transferToCpuAddress);
+        EXPECT_EQ(chunkSize, pageFaultManager->transferToCpuSize);
+        EXPECT_EQ(chunkPtr, pageFaultManager->allowedMemoryAccessAddress);
+        EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    }
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 5 * chunkSize + 0x20)));
+    EXPECT_EQ(3, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(3u, pageFaultManager->memoryData[alloc].cpuRanges.size());
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(4u, statistics.pageFaults);
+    EXPECT_EQ(3u, statistics.transfersToCpu);
+    EXPECT_EQ(3 * chunkSize, statistics.bytesTransferredToCpu);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(2, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(4, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(ptrOffset(alloc, allocSize - chunkSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->protectedSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].cpuRanges.empty());
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+
+    statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(allocSize + 3 * chunkSize, statistics.bytesTransferredToGpu);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedMigrationWithPrefetchWhenVerifyingPageFaultThenFollowingChunksUpToNextCpuRangeAreTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    DebugManager.flags.UsmSharedMigrationPrefetchChunks.set(3);
+
+    constexpr size_t chunkSize = MemoryConstants::pageSize64k;
+    constexpr size_t allocSize = 10 * chunkSize;
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 5 * chunkSize));
+    EXPECT_EQ(ptrOffset(alloc, 5 * chunkSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->transferToCpuSize);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize));
+    EXPECT_EQ(ptrOffset(alloc, 2 * chunkSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(3 * chunkSize, pageFaultManager->transferToCpuSize);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 9 * chunkSize));
+    EXPECT_EQ(ptrOffset(alloc, 9 * chunkSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(3, pageFaultManager->transferToCpuCalled);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkSizeNotSmallerThanAllocationWhenInsertingAllocationThenWholeAllocationIsMigrated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::pageSize64k, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc].migrationChunkSize);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize));
+    EXPECT_EQ(alloc, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(MemoryConstants::pageSize64k, pageFaultManager->transferToCpuSize);
+}
+
 TEST_F(PageFaultManagerTest, givenInitialPlacementCpuWhenVerifyingPagefaultThenFirstAccessDoesNotInvokeTransfer) {
     void *alloc = reinterpret_cast<void *>(0x1);
 
@@ -12,6 +12,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <map>
 #include <random>
 
 using namespace NEO;
@@ -31,14 +32,14 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     size_t getThresholdSize() const { return this->sizeThreshold; }
     using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec, size_t requiredAlignment) {
+    uint64_t getFromFreedChunks(size_t size, HeapFreedChunks &vec, size_t requiredAlignment) {
         size_t sizeOfFreedChunk;
         return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk, requiredAlignment);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, HeapFreedChunks &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    HeapFreedChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    HeapFreedChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
@@ -79,10 +80,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.store(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks, allocationAlignment);
 
@@ -95,15 +96,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x102000llu, 4096);
+    freedChunks.store(0x10a000llu, 4096);
+    freedChunks.store(0x108000llu, 4096);
+    freedChunks.store(0x104000llu, 8192);
+    freedChunks.store(0x110000llu, 8192);
+    freedChunks.store(0x10e000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -120,21 +121,22 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.store(pUpperBound, 4096);
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.store(pUpperBound, 4 * 4096);
 
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.store(pUpperBound, 4 * 4096);
+    // equally sized chunks are taken from the lowest address first
+    ptrExpected = pUpperBound;
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -151,15 +153,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
+    pLowerBound += 10 * 4096;
+    freedChunks.store(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -171,8 +173,8 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    EXPECT_EQ(pLowerBound, freedChunks.getChunks()[2].ptr);
+    EXPECT_EQ(deltaSize, freedChunks.getChunks()[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenMoreThanTwiceBiggerSizeChunksInFreedChunksWhenGetIsCalledAndAlignmentDoesNotThenNullIsReturned) {
@@ -184,13 +186,13 @@ TEST(HeapAllocatorTest, GivenMoreThanTwiceBiggerSizeChunksInFreedChunksWhenGetIs
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 2 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 3 * 4096);
+    freedChunks.store(pLowerBound, 9 * 4096);
+    pLowerBound += 11 * 4096;
+    freedChunks.store(pLowerBound, 3 * 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -207,18 +209,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -231,8 +233,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -242,11 +244,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.store(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -254,11 +256,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -269,8 +271,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -280,11 +282,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -298,8 +300,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(ptrToStore, freedChunks.getChunks()[2].ptr);
+    EXPECT_EQ(sizeToStore, freedChunks.getChunks()[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCalledThenChunksAreMerged) {
@@ -307,10 +309,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x103000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x103000llu, 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -327,6 +329,39 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     EXPECT_EQ(1u, freedChunks.size());
 }
 
+TEST(HeapAllocatorTest, GivenFreedChunksCountCrossingIndexThresholdWhenStoringAndGettingThenChunksAreIndexedAndLinearAgainBelowHalfOfThreshold) {
+    HeapFreedChunks freedChunks;
+    const uint64_t ptrBase = 0x100000llu;
+    const size_t chunkSize = MemoryConstants::pageSize;
+
+    for (size_t i = 0; i < HeapFreedChunks::indexThreshold; i++) {
+        freedChunks.store(ptrBase + 2 * i * chunkSize, chunkSize);
+    }
+    EXPECT_FALSE(freedChunks.isIndexed());
+
+    freedChunks.store(ptrBase + 2 * HeapFreedChunks::indexThreshold * chunkSize, 2 * chunkSize);
+    EXPECT_TRUE(freedChunks.isIndexed());
+    EXPECT_EQ(HeapFreedChunks::indexThreshold + 1, freedChunks.size());
+    EXPECT_EQ((HeapFreedChunks::indexThreshold + 2) * chunkSize, freedChunks.getTotalSize());
+    EXPECT_EQ(2 * chunkSize, freedChunks.getLargestChunkSize());
+
+    size_t sizeOfFreedChunk = 0;
+    EXPECT_EQ(ptrBase + 2 * HeapFreedChunks::indexThreshold * chunkSize, freedChunks.get(2 * chunkSize, MemoryConstants::pageSize, sizeOfFreedChunk));
+
+    while (freedChunks.size() >= HeapFreedChunks::indexThreshold / 2) {
+        EXPECT_TRUE(freedChunks.isIndexed());
+        auto expectedPtr = freedChunks.getChunks()[0].ptr;
+        EXPECT_EQ(expectedPtr, freedChunks.get(chunkSize, MemoryConstants::pageSize, sizeOfFreedChunk));
+    }
+    EXPECT_FALSE(freedChunks.isIndexed());
+    EXPECT_EQ(freedChunks.size() * chunkSize, freedChunks.getTotalSize());
+
+    auto chunks = freedChunks.getChunks();
+    for (size_t i = 1; i < chunks.size(); i++) {
+        EXPECT_EQ(chunks[i - 1].ptr + 2 * chunkSize, chunks[i].ptr);
+    }
+}
+
 TEST(HeapAllocatorTest, WhenAllocatingThenEntryIsAddedToMap) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -781,7 +816,7 @@ TEST(HeapAllocatorTest, WhenMemoryIsAllocatedThenAllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
-TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented) {
+TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenAdjacentChunksAreCoalesced) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -793,7 +828,7 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -820,24 +855,22 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ(basePtr, freedChunks.getChunks()[0].ptr);
+    EXPECT_EQ(3 * allocSize, freedChunks.getChunks()[0].size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(5 * allocSize, freedChunks.getChunks()[1].size);
 }
 
-TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented) {
+TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenAdjacentChunksAreCoalesced) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000;
 
@@ -850,7 +883,7 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -877,21 +910,19 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks.getChunks()[0].ptr);
+    EXPECT_EQ(5 * allocSize, freedChunks.getChunks()[0].size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(3 * allocSize, freedChunks.getChunks()[1].size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -901,7 +932,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -937,8 +968,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -998,8 +1029,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -1449,3 +1480,111 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, GivenStoredChunksAdjacentToBothBoundariesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMergedIntoOne) {
+    HeapFreedChunks freedChunks;
+
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x103000llu, 2 * 4096);
+    freedChunks.store(0x110000llu, 4096);
+    EXPECT_EQ(3u, freedChunks.size());
+
+    freedChunks.store(0x101000llu, 2 * 4096);
+
+    ASSERT_EQ(2u, freedChunks.size());
+    EXPECT_EQ(0x100000llu, freedChunks.getChunks()[0].ptr);
+    EXPECT_EQ(5u * 4096, freedChunks.getChunks()[0].size);
+    EXPECT_EQ(6u * 4096, freedChunks.getTotalSize());
+    EXPECT_EQ(5u * 4096, freedChunks.getLargestChunkSize());
+}
+
+TEST(HeapAllocatorTest, GivenFreedChunksWhenGettingFragmentationStatisticsThenLargestFreeBlockAndFragmentationAreReturned) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 64 * 4096;
+    size_t threshold = 4096;
+    HeapAllocatorUnderTest heapAllocator(ptrBase, size, allocationAlignment, threshold);
+
+    auto statistics = heapAllocator.getFragmentationStatistics();
+    EXPECT_EQ(0u, statistics.freedChunksCount);
+    EXPECT_EQ(size, statistics.freeSize);
+    EXPECT_EQ(size, statistics.largestFreeBlockSize);
+    EXPECT_EQ(0.0, statistics.fragmentation);
+
+    size_t bigSize = 8 * 4096;
+    size_t smallSize = 4096;
+    auto bigPtr0 = heapAllocator.allocate(bigSize);
+    heapAllocator.allocate(bigSize);
+    auto smallPtr0 = heapAllocator.allocate(smallSize);
+    heapAllocator.allocate(smallSize);
+    heapAllocator.free(bigPtr0, bigSize);
+    heapAllocator.free(smallPtr0, smallSize);
+
+    statistics = heapAllocator.getFragmentationStatistics();
+    EXPECT_EQ(2u, statistics.freedChunksCount);
+    EXPECT_EQ(bigSize + smallSize, statistics.freedChunksSize);
+    EXPECT_EQ(size - bigSize - smallSize, statistics.freeSize);
+    EXPECT_EQ(heapAllocator.getLeftSize(), statistics.freeSize);
+
+    uint64_t middleGap = heapAllocator.getRightBound() - heapAllocator.getLeftBound();
+    EXPECT_EQ(middleGap, statistics.largestFreeBlockSize);
+    EXPECT_DOUBLE_EQ(1.0 - static_cast<double>(middleGap) / static_cast<double>(statistics.freeSize), statistics.fragmentation);
+}
+
+TEST(HeapAllocatorTest, GivenRandomAllocationTraceWhenReplayedThenAllocationsDoNotOverlapAndHeapIsFullyRestored) {
+    const uint64_t ptrBase = 0x100000llu;
+    const size_t size = 4096 * 4096;
+    const size_t threshold = 16 * 4096;
+    HeapAllocatorUnderTest heapAllocator(ptrBase, size, allocationAlignment, threshold);
+
+    std::mt19937 generator(0x5eed);
+    std::uniform_int_distribution<size_t> sizeDistribution(1, 32 * 4096);
+    std::uniform_int_distribution<uint32_t> actionDistribution(0, 2);
+
+    std::map<uint64_t, size_t> liveAllocations;
+    uint64_t usedSize = 0u;
+
+    auto overlapsLiveAllocation = [&](uint64_t ptr, size_t allocationSize) {
+        auto next = liveAllocations.lower_bound(ptr);
+        if (next != liveAllocations.end() && next->first < ptr + allocationSize) {
+            return true;
+        }
+        if (next != liveAllocations.begin()) {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second > ptr) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        if (liveAllocations.empty() || actionDistribution(generator) != 0) {
+            size_t allocationSize = sizeDistribution(generator);
+            auto ptr = heapAllocator.allocate(allocationSize);
+            if (ptr == 0llu) {
+                continue;
+            }
+            EXPECT_TRUE(isAligned(ptr, allocationAlignment));
+            EXPECT_GE(ptr, ptrBase);
+            EXPECT_LE(ptr + allocationSize, ptrBase + size);
+            ASSERT_FALSE(overlapsLiveAllocation(ptr, allocationSize));
+            liveAllocations[ptr] = allocationSize;
+            usedSize += allocationSize;
+        } else {
+            auto allocation = liveAllocations.begin();
+            std::advance(allocation, generator() % liveAllocations.size());
+            heapAllocator.free(allocation->first, allocation->second);
+            usedSize -= allocation->second;
+            liveAllocations.erase(allocation);
+        }
+        ASSERT_EQ(usedSize, heapAllocator.getUsedSize());
+    }
+
+    for (auto &allocation : liveAllocations) {
+        heapAllocator.free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    size_t fullSize = size;
+    EXPECT_EQ(ptrBase, heapAllocator.allocate(fullSize));
+}
@@ -20,7 +20,9 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cstdint>
+#include <thread>
 
 using namespace NEO;
 
@@ -85,7 +87,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
-    using BaseClass::usedTags;
+    using BaseClass::usedTagsCount;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
     MockTagAllocator(uint32_t rootDeviceIndex, MemoryManager *memoryManager, size_t tagCount,
@@ -109,8 +111,8 @@ class MockTagAllocator : public TagAllocator<TagType> {
         return this->freeTags.peekHead();
     }
 
-    TagNodeT *getUsedTagsHead() {
-        return this->usedTags.peekHead();
+    size_t getUsedTagsCount() {
+        return this->usedTagsCount.load();
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -134,7 +136,7 @@ TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItIsCorrectlyInitialized)
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tagForCpuAccess);
@@ -147,28 +149,25 @@ TEST_F(TagAllocatorTest, WhenGettingAndReturningTagThenFreeAndUsedListsAreUpdate
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
 
     EXPECT_NE(nullptr, tagNode);
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
-    IDList<TagNode<TimeStamps>> &usedList = tagAllocator.usedTags;
+    auto &freeList = tagAllocator.freeTags;
 
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
     bool isFoundOnFreeList = freeList.peekContains(*tagNode);
 
     EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
     isFoundOnFreeList = freeList.peekContains(*tagNode);
 
     EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, WhenTagAllocatorIsCreatedThenItPopulatesTagsWithProperDeviceBitfield) {
@@ -237,7 +236,7 @@ TEST_F(TagAllocatorTest, givenInputTagCountWhenCreatingAllocatorThenRequestedNum
 
     while (head) {
         nodesFound++;
-        head = head->next;
+        head = tagAllocator.freeTags.peekNext(*head);
     }
     EXPECT_EQ(tagsCount, nodesFound);
 }
@@ -264,7 +263,7 @@ TEST_F(TagAllocatorTest, GivenSpecificOrderWhenReturningTagsThenFreeListIsUpdate
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
+    auto &freeList = tagAllocator.freeTags;
     bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
@@ -356,18 +355,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount()); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount()); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToFreeList) {
@@ -439,6 +438,50 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenMultipleThreadsWhenGettingAndReturningTagsConcurrentlyThenEachNodeIsOwnedOnceAndAllNodesAreReturned) {
+    constexpr size_t tagsCount = 8;
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t iterationsCount = 1000;
+    constexpr uint32_t tagsPerIteration = 4;
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, tagsCount, 1, deviceBitfield);
+
+    std::atomic<uint32_t> doubleOwnedNodes{0};
+    auto worker = [&](uint64_t ownerId) {
+        TagNode<TimeStamps> *nodes[tagsPerIteration] = {};
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            for (auto &node : nodes) {
+                node = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+                node->tagForCpuAccess->start = ownerId;
+            }
+            for (auto &node : nodes) {
+                if (node->tagForCpuAccess->start != ownerId) {
+                    doubleOwnedNodes++;
+                }
+                tagAllocator.returnTag(node);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(worker, i + 1);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, doubleOwnedNodes);
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
+
+    size_t expectedNodesCount = tagAllocator.getTagPoolCount() * tagsCount;
+    size_t nodesFound = 0;
+    for (auto node = tagAllocator.freeTags.peekHead(); node != nullptr && nodesFound <= expectedNodesCount; node = tagAllocator.freeTags.peekNext(*node)) {
+        nodesFound++;
+    }
+    EXPECT_EQ(expectedNodesCount, nodesFound);
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
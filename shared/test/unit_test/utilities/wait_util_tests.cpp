@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
@@ -16,6 +17,10 @@ using namespace NEO;
 
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint32_t> umwaitCounter;
+extern std::atomic<uintptr_t> lastUmonitorPtr;
+extern std::atomic<uint64_t> lastUmwaitCounter;
+extern std::atomic<uint64_t> rdtscValue;
 } // namespace CpuIntrinsicsTests
 
 TEST(WaitTest, givenDefaultSettingsWhenNoPollAddressProvidedThenPauseDefaultTimeAndReturnFalse) {
@@ -90,3 +95,98 @@ TEST(WaitTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsCriteriaThenPaus
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(WaitTest, givenDebugFlagsOverridesWhenInitializingThenWaitTiersAreSet) {
+    DebugManagerStateRestore restore;
+    VariableBackup<int64_t> backupYieldThreshold(&WaitUtils::yieldThresholdInMicroSeconds);
+    VariableBackup<int64_t> backupBlockThreshold(&WaitUtils::blockThresholdInMicroSeconds);
+    VariableBackup<int64_t> backupBlockTime(&WaitUtils::blockTimeInMicroSeconds);
+    VariableBackup<uint64_t> backupWaitpkgCounterValue(&WaitUtils::waitpkgCounterValue);
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse);
+
+    EXPECT_EQ(0, WaitUtils::defaultBlockThresholdInMicroSeconds);
+
+    WaitUtils::init();
+    EXPECT_EQ(WaitUtils::defaultYieldThresholdInMicroSeconds, WaitUtils::yieldThresholdInMicroSeconds);
+    EXPECT_EQ(WaitUtils::defaultBlockThresholdInMicroSeconds, WaitUtils::blockThresholdInMicroSeconds);
+    EXPECT_EQ(WaitUtils::defaultBlockTimeInMicroSeconds, WaitUtils::blockTimeInMicroSeconds);
+    EXPECT_EQ(WaitUtils::defaultWaitpkgCounterValue, WaitUtils::waitpkgCounterValue);
+    EXPECT_EQ(CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg), WaitUtils::waitpkgUse);
+
+    DebugManager.flags.WaitYieldThresholdInMicroSeconds.set(5);
+    DebugManager.flags.WaitBlockThresholdInMicroSeconds.set(50);
+    DebugManager.flags.WaitBlockTimeInMicroSeconds.set(2);
+    DebugManager.flags.WaitpkgCounterValue.set(1000);
+    DebugManager.flags.EnableWaitpkg.set(0);
+
+    WaitUtils::init();
+    EXPECT_EQ(5, WaitUtils::yieldThresholdInMicroSeconds);
+    EXPECT_EQ(50, WaitUtils::blockThresholdInMicroSeconds);
+    EXPECT_EQ(2, WaitUtils::blockTimeInMicroSeconds);
+    EXPECT_EQ(1000u, WaitUtils::waitpkgCounterValue);
+    EXPECT_FALSE(WaitUtils::waitpkgUse);
+}
+
+TEST(WaitTest, givenWaitpkgUsedAndTimeElapsedAboveBlockThresholdWhenPollAddressDoesNotMeetCriteriaThenUmwaitOnPollAddressAndReturnFalse) {
+    VariableBackup<int64_t> backupBlockThreshold(&WaitUtils::blockThresholdInMicroSeconds, 100);
+    VariableBackup<uint64_t> backupWaitpkgCounterValue(&WaitUtils::waitpkgCounterValue, 1000u);
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, true);
+    CpuIntrinsicsTests::rdtscValue = 5000u;
+
+    volatile TagAddressType pollValue = 1u;
+    TaskCountType expectedValue = 3;
+
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue, 100);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(oldPauseCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount + 1, CpuIntrinsicsTests::umwaitCounter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&pollValue), CpuIntrinsicsTests::lastUmonitorPtr);
+    EXPECT_EQ(6000u, CpuIntrinsicsTests::lastUmwaitCounter);
+}
+
+TEST(WaitTest, givenWaitpkgUsedAndTimeElapsedAboveBlockThresholdWhenPollAddressMeetsCriteriaThenDoNotUmwaitAndReturnTrue) {
+    VariableBackup<int64_t> backupBlockThreshold(&WaitUtils::blockThresholdInMicroSeconds, 100);
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, true);
+
+    volatile TagAddressType pollValue = 3u;
+    TaskCountType expectedValue = 1;
+
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue, 200);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}
+
+TEST(WaitTest, givenTimeElapsedBelowBlockThresholdOrBlockingDisabledWhenPollAddressDoesNotMeetCriteriaThenDoNotUmwait) {
+    VariableBackup<int64_t> backupBlockThreshold(&WaitUtils::blockThresholdInMicroSeconds, 100);
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, true);
+
+    volatile TagAddressType pollValue = 1u;
+    TaskCountType expectedValue = 3;
+
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    EXPECT_FALSE(WaitUtils::waitFunction(&pollValue, expectedValue, 99));
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+
+    WaitUtils::blockThresholdInMicroSeconds = 0;
+    EXPECT_FALSE(WaitUtils::waitFunction(&pollValue, expectedValue, 1000));
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}
+
+TEST(WaitTest, givenWaitpkgNotUsedAndTimeElapsedAboveBlockThresholdWhenPollAddressDoesNotMeetCriteriaThenSleepInsteadOfUmwait) {
+    VariableBackup<int64_t> backupBlockThreshold(&WaitUtils::blockThresholdInMicroSeconds, 100);
+    VariableBackup<int64_t> backupBlockTime(&WaitUtils::blockTimeInMicroSeconds, 0);
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, false);
+
+    volatile TagAddressType pollValue = 1u;
+    TaskCountType expectedValue = 3;
+
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue, 100);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(oldPauseCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}
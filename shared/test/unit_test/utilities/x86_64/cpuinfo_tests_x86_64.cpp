@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,7 +50,9 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
@@ -62,7 +64,9 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }
@@ -74,7 +78,9 @@ TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     CpuInfo testCpuInfo;
 
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
 }